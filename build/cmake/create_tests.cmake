@@ -81,7 +81,7 @@ foreach(TEST_TARGET ${ALL_SHAREDLIB_TARGETS})
         COMMAND ${TEST_RUNNER} "$<TARGET_FILE:${TEST_EXE_NAME}>" test.amlg
         WORKING_DIRECTORY ${CMAKE_SOURCE_DIR}/test/lib_smoke_test
     )
-    set_tests_properties(${TEST_NAME} PROPERTIES PASS_REGULAR_EXPRESSION "${AMALGAM_VERSION_FULL_ESCAPED}")
+    set_tests_properties(${TEST_NAME} PROPERTIES PASS_REGULAR_EXPRESSION "${AMALGAM_VERSION_FULL_ESCAPED}" FAIL_REGULAR_EXPRESSION "FAIL:")
     list(APPEND ALL_TEST_TARGETS ${TEST_NAME})
 
 endforeach()
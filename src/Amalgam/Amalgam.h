@@ -62,6 +62,16 @@ extern "C"
 	AMALGAM_EXPORT wchar_t *ExecuteEntityJsonPtrWide(char *handle, char *label, char *json);
 	AMALGAM_EXPORT char *ExecuteEntityJsonPtr(char *handle, char *label, char *json);
 
+	//executes label on handle with num_args numeric arguments named by arg_names with values arg_values
+	//returns the result as a number, or NaN if the result is not a number, including strings that contain numbers
+	AMALGAM_EXPORT double ExecuteEntityNumber(char *handle, char *label, uint64_t num_args, char **arg_names, double *arg_values);
+
+	//builds the query caches of the entities contained in handle for the num_labels labels in label_names
+	//returns false if the entity does not exist or query caches are disabled
+	//in multithreaded builds, may be called from a separate thread after loading to warm the caches,
+	// while the first queries run and only wait on the label currently being built
+	AMALGAM_EXPORT bool CacheContainedEntityLabels(char *handle, uint64_t num_labels, char **label_names);
+
 	AMALGAM_EXPORT wchar_t *GetVersionStringWide();
 	AMALGAM_EXPORT char *GetVersionString();
 
@@ -70,8 +80,30 @@ extern "C"
 
 	AMALGAM_EXPORT void SetSBFDataStoreEnabled(bool enable_SBF_datastore);
 	AMALGAM_EXPORT bool IsSBFDataStoreEnabled();
+	AMALGAM_EXPORT void SetQueryResultCacheEnabled(bool enable_query_result_cache);
+	AMALGAM_EXPORT bool IsQueryResultCacheEnabled();
 	AMALGAM_EXPORT size_t GetMaxNumThreads();
 	AMALGAM_EXPORT void SetMaxNumThreads(size_t max_num_threads);
+	AMALGAM_EXPORT size_t GetKnnCacheMemoryBudget();
+	AMALGAM_EXPORT void SetKnnCacheMemoryBudget(size_t num_bytes);
+
+	//if enabled, query cache matrices allocated afterward request huge pages, falling back to regular pages
+	AMALGAM_EXPORT void SetHugePagesEnabled(bool enable_huge_pages);
+	AMALGAM_EXPORT bool IsHugePagesEnabled();
+	//returns the number of bytes of memory of the process backed by huge pages, 0 if not available on the platform
+	AMALGAM_EXPORT size_t GetHugePageMemoryInBytes();
+
+	//soft memory limit in bytes for the nodes of each entity that does not have its own limit, 0 for no limit
+	AMALGAM_EXPORT size_t GetGarbageCollectionSoftMemoryLimit();
+	AMALGAM_EXPORT void SetGarbageCollectionSoftMemoryLimit(size_t num_bytes);
+	//target fraction of time spent collecting garbage, which spaces out collections when allocation is fast, 0 to disable
+	AMALGAM_EXPORT double GetGarbageCollectionTargetOverhead();
+	AMALGAM_EXPORT void SetGarbageCollectionTargetOverhead(double overhead);
+	//sets the soft memory limit in bytes for the nodes of the entity specified by handle, 0 to use the process-wide limit
+	AMALGAM_EXPORT bool SetEntityGarbageCollectionSoftMemoryLimit(char *handle, size_t num_bytes);
+	//returns the garbage collection metrics of the entity specified by handle as json
+	AMALGAM_EXPORT wchar_t *GetEntityGarbageCollectionMetricsWide(char *handle);
+	AMALGAM_EXPORT char *GetEntityGarbageCollectionMetrics(char *handle);
 
 	//for APIs that pass strings back, that memory needs to be cleaned up by the caller
 	AMALGAM_EXPORT void DeleteString(char *p);
@@ -4,6 +4,9 @@
 #include "Concurrency.h"
 #include "EntityExternalInterface.h"
 #include "EntityQueries.h"
+#include "EvaluableNodeManagement.h"
+#include "KnnCache.h"
+#include "PlatformSpecific.h"
 
 //system headers:
 #include <string>
@@ -198,6 +201,19 @@ extern "C"
 		return StringToCharPtr(ret);
 	}
 
+	double ExecuteEntityNumber(char *handle, char *label, uint64_t num_args, char **arg_names, double *arg_values)
+	{
+		std::string h(handle);
+		std::string l(label);
+		return entint.ExecuteEntityNumber(h, l, static_cast<size_t>(num_args), arg_names, arg_values);
+	}
+
+	bool CacheContainedEntityLabels(char *handle, uint64_t num_labels, char **label_names)
+	{
+		std::string h(handle);
+		return entint.CacheContainedEntityLabels(h, static_cast<size_t>(num_labels), label_names);
+	}
+
 	void ExecuteEntity(char *handle, char *label)
 	{
 		std::string h(handle);
@@ -257,6 +273,16 @@ extern "C"
 		return _enable_SBF_datastore;
 	}
 
+	void SetQueryResultCacheEnabled(bool enable_query_result_cache)
+	{
+		_enable_query_result_cache = enable_query_result_cache;
+	}
+
+	bool IsQueryResultCacheEnabled()
+	{
+		return _enable_query_result_cache;
+	}
+
 	size_t GetMaxNumThreads()
 	{
 	#if defined(MULTITHREAD_SUPPORT) || defined(_OPENMP)
@@ -272,4 +298,69 @@ extern "C"
 		Concurrency::SetMaxNumThreads(max_num_threads);
 	#endif
 	}
+
+	size_t GetKnnCacheMemoryBudget()
+	{
+		return _knn_cache_memory_budget;
+	}
+
+	void SetKnnCacheMemoryBudget(size_t num_bytes)
+	{
+		_knn_cache_memory_budget = num_bytes;
+	}
+
+	void SetHugePagesEnabled(bool enable_huge_pages)
+	{
+		_enable_huge_pages = enable_huge_pages;
+	}
+
+	bool IsHugePagesEnabled()
+	{
+		return _enable_huge_pages;
+	}
+
+	size_t GetHugePageMemoryInBytes()
+	{
+		return Platform_GetHugePageMemoryInBytes();
+	}
+
+	size_t GetGarbageCollectionSoftMemoryLimit()
+	{
+		return _gc_soft_memory_limit;
+	}
+
+	void SetGarbageCollectionSoftMemoryLimit(size_t num_bytes)
+	{
+		_gc_soft_memory_limit = num_bytes;
+	}
+
+	double GetGarbageCollectionTargetOverhead()
+	{
+		return _gc_target_overhead;
+	}
+
+	void SetGarbageCollectionTargetOverhead(double overhead)
+	{
+		_gc_target_overhead = overhead;
+	}
+
+	bool SetEntityGarbageCollectionSoftMemoryLimit(char *handle, size_t num_bytes)
+	{
+		std::string h(handle);
+		return entint.SetEntityGarbageCollectionSoftMemoryLimit(h, num_bytes);
+	}
+
+	wchar_t *GetEntityGarbageCollectionMetricsWide(char *handle)
+	{
+		std::string h(handle);
+		std::string ret = entint.GetEntityGarbageCollectionMetrics(h);
+		return StringToWCharPtr(ret);
+	}
+
+	char *GetEntityGarbageCollectionMetrics(char *handle)
+	{
+		std::string h(handle);
+		std::string ret = entint.GetEntityGarbageCollectionMetrics(h);
+		return StringToCharPtr(ret);
+	}
 }
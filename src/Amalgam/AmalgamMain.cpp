@@ -68,6 +68,8 @@ Options:
 
     --nosbfds        Disables the sbfds acceleration, which is generally preferred in the heuristics
 
+    --query-result-cache  Reuses the results of identical queries on an entity until its contained entities are modified
+
     --trace          Uses commands via stdio to act as if it were being called as a library
 
     --tracefile [file]
@@ -167,6 +169,8 @@ PLATFORM_MAIN_CONSOLE
 			debug_sources = true;
 		else if(args[i] == "--nosbfds")
 			_enable_SBF_datastore = false;
+		else if(args[i] == "--query-result-cache")
+			_enable_query_result_cache = true;
 		else if(args[i] == "--trace")
 			run_trace = true;
 		else if(args[i] == "--tracefile" && i + 1 < args.size())
@@ -326,6 +330,9 @@ PLATFORM_MAIN_CONSOLE
 
 			delete entity;
 
+			//the integer string cache intentionally keeps its strings
+			string_intern_pool.ClearCachedIntegerStrings();
+
 			auto num_strings_used = string_intern_pool.GetNumDynamicStringsInUse();
 			//there should always at least be the empty string
 			if(num_strings_used > 0)
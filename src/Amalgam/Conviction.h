@@ -21,6 +21,7 @@ public:
 		std::vector<DistanceReferencePair<size_t>> updatedDistanceContribs;
 		std::vector<double> baseDistanceContributions;
 		std::vector<double> baseDistanceProbabilities;
+		std::vector<EntityReference> entitiesToCache;
 	};
 
 #ifdef MULTITHREAD_SUPPORT
@@ -77,6 +78,20 @@ public:
 	
 		if(entities_to_compute == nullptr)
 			entities_to_compute = knnCache->GetRelevantEntities();
+
+	#ifdef MULTITHREAD_SUPPORT
+		if(ComputeValuesConcurrently(*entities_to_compute, contribs_out,
+			[](ConvictionProcessor &processor, EntityReference entity_reference, size_t index)
+			{
+				return processor.ComputeDistanceContribution(entity_reference);
+			}))
+		{
+			//sum in order so the result does not depend on concurrency
+			for(double contrib : contribs_out)
+				contribs_sum_out += contrib;
+			return;
+		}
+	#endif
 	
 		//compute distance contribution for each entity in entities_to_compute
 		contribs_out.resize(entities_to_compute->size());
@@ -97,7 +112,31 @@ public:
 	#ifdef MULTITHREAD_SUPPORT
 		//only cache concurrently if computing for all entities
 		if(runConcurrently && (entities_to_compute == nullptr || entities_to_compute->size() == knnCache->GetNumRelevantEntities()))
-			knnCache->PreCacheAllKnn(numNearestNeighbors, true);
+		{
+			if(entities_to_compute == nullptr)
+				entities_to_compute = knnCache->GetRelevantEntities();
+
+			//each entity's nearest neighbors are only needed for its own distance contribution,
+			// so cache them in blocks that fit within the memory budget and free each block after use
+			size_t max_block_size = knnCache->GetMaxNumEntitiesToCache(numNearestNeighbors);
+			auto &block = buffers->entitiesToCache;
+			block.clear();
+			block.reserve(std::min(max_block_size, entities_to_compute->size()));
+
+			contribs_out.resize(entities_to_compute->size());
+			size_t out_index = 0;
+			for(auto entity_reference : *entities_to_compute)
+			{
+				block.push_back(entity_reference);
+				if(block.size() >= max_block_size)
+					ComputeDistanceContributionsForBlock(block, contribs_out, out_index);
+			}
+
+			if(block.size() > 0)
+				ComputeDistanceContributionsForBlock(block, contribs_out, out_index);
+
+			return;
+		}
 	#endif
 
 		double contribs_sum_out = 0.0;
@@ -112,6 +151,28 @@ public:
 		buffers->neighbors.reserve(numNearestNeighbors + 1);
 		contribs_sum_out = 0.0;
 
+	#ifdef MULTITHREAD_SUPPORT
+		if(ComputeValuesConcurrently(*knnCache->GetRelevantEntities(), contribs_out,
+			[&included_entities, excluded_entity_distance_contribution_value]
+			(ConvictionProcessor &processor, EntityReference entity_reference, size_t index)
+			{
+				if(!included_entities.contains(entity_reference))
+					return excluded_entity_distance_contribution_value;
+				return processor.ComputeDistanceContribution(entity_reference, included_entities);
+			}))
+		{
+			//sum in order so the result does not depend on concurrency
+			size_t out_index = 0;
+			for(auto entity_reference : *knnCache->GetRelevantEntities())
+			{
+				if(included_entities.contains(entity_reference))
+					contribs_sum_out += contribs_out[out_index];
+				out_index++;
+			}
+			return;
+		}
+	#endif
+
 		//compute distance contribution for each entity in entities_to_compute
 		contribs_out.resize(knnCache->GetNumRelevantEntities());
 		size_t out_index = 0;
@@ -204,6 +265,95 @@ public:
 		}
 	}
 
+	//Computes the KL divergence of removing the case entity_reference from the model, or of adding it if conviction_of_removal is false,
+	// where distance_contribution_index is the index of entity_reference within the entities being computed
+	//base_dist_contribs, base_dist_probabilities, and base_dist_contrib_sum are the distance contributions, probabilities, and sum of all relevant entities
+	//uses this processor's buffers for intermediate results, and the result may be negative due to numerical error
+	inline double ComputeCaseKLDivergence(EntityReference entity_reference, size_t distance_contribution_index,
+		const std::vector<double> &base_dist_contribs, const std::vector<double> &base_dist_probabilities,
+		const double base_dist_contrib_sum, bool conviction_of_removal)
+	{
+		//cache constants for expected values
+		const size_t num_relevant_entities = knnCache->GetNumRelevantEntities();
+		const double probability_mass_of_non_holdouts = (1.0 - 1.0 / num_relevant_entities);
+		// the reciprocal of the ratio of num cases without to num cases with times the contrib_sum; cached for scaling below
+		// using the reciprocal here (instead of the more intuitive flip) saves a negation in the loop
+		const double updated_contrib_to_contrib_scale_inverse = num_relevant_entities / (base_dist_contrib_sum * (num_relevant_entities - 1));
+
+		//for measuring kl divergence, only need to measure those entities that have a value that is different
+		auto &updated_distance_contribs = buffers->updatedDistanceContribs;
+
+		//compute the scaled distance contributions and sums when any 1 case is removed from the model
+		//note that the kl_divergence for every non-scaled set is 0, so the sum will not change except for when a case is actually removed from the model
+
+		//compute distance contributions of the entities whose dcs will be changed by the removal of entity_reference
+		updated_distance_contribs.clear();
+		double updated_contrib_sum = 0.0;
+		buffers->neighbors.clear();
+		UpdateDistanceContributionsWithHoldout(entity_reference, 1.0 / num_relevant_entities, base_dist_contribs, base_dist_contrib_sum,
+			updated_distance_contribs, updated_contrib_sum);
+
+		//convert updated_distance_contribs to probabilities
+		//convert via the updated contribution sum and multiply by the probability mass of everything that isn't the holdout
+		//multiplying a non-held out distance contribution by this value converts it into a probability
+		double updated_dc_to_probability = probability_mass_of_non_holdouts / updated_contrib_sum;
+
+		//convert updated distance contribution into a probability as appropriate
+		for(auto &dc : updated_distance_contribs)
+		{
+			//the knockout case was already already assigned the probability
+			if(dc.reference != distance_contribution_index)
+				dc.distance *= updated_dc_to_probability;
+		}
+
+		//compute KL divergence for the values which have different neighbor lists
+
+		//need to compute the KL divergence for the cases that don't have different neighbor lists but are only scaled
+		//for conviction_of_removal, this can be computed as
+		//d_KL = sum_i -base_distance_probabilities[i] * log( base_distance_probabilities[i] / new_probabilities[i])
+		//but because we know new_probabilities[i] = base_distance_probabilities[i] * dc_update_scale we can rewrite this as:
+		// d_KL = sum_i -base_distance_probabilities[i] * log( 1 / dc_update_scale) )
+		//the logarithm doesn't change and can be pulled out of the sum (pulling out the reciprocal as -1) to be:
+		// d_KL = log( dc_update_scale) ) * sum_i base_distance_probabilities[i]
+		//but because we've already computed the kl divergence for the updated_distance_contribs (changed neighbor sets),
+		// we only want to compute d_KL for those that just need to be scaled
+		//for the opposite, the conviction of adding the case, we just flip p and q in the kl divergence:
+		// d_KL = sum_i -new_probabilities[i] * log( new_probabilities[i] / base_distance_probabilities[i] )
+		//thus (note the negative sign due to the reciprocal of dc_update_scale):
+		// d_KL = sum_i -new_probabilities[i] * log( dc_update_scale) )
+		double dc_update_scale = updated_contrib_sum * updated_contrib_to_contrib_scale_inverse;
+
+		double kld_updated;
+		double kld_scaled;
+		if(conviction_of_removal)
+		{
+			kld_updated = PartialKullbackLeiblerDivergenceFromIndices(base_dist_probabilities, updated_distance_contribs);
+
+			//need to find unchanged distance contribution relative to the total in order to find the total probability mass
+			double total_distance_contribution_unchanged = base_dist_contrib_sum;
+			for(auto &dc : updated_distance_contribs)
+				total_distance_contribution_unchanged -= base_dist_contribs[dc.reference];
+
+			double total_probability_mass_changed = (total_distance_contribution_unchanged / base_dist_contrib_sum);
+
+			kld_scaled = total_probability_mass_changed * std::log(dc_update_scale);
+		}
+		else
+		{
+			kld_updated = PartialKullbackLeiblerDivergenceFromIndices(updated_distance_contribs, base_dist_probabilities);
+
+			//since the updated distance contribs have already been converted to probabilities, can just use them directly
+			double total_updated_probability_mass_changed = 1.0;
+			for(auto &dc : updated_distance_contribs)
+				total_updated_probability_mass_changed -= dc.distance;
+
+			//negative sign due to the reciprocal of dc_update_scale
+			kld_scaled = -total_updated_probability_mass_changed * std::log(dc_update_scale);
+		}
+
+		return kld_updated + kld_scaled;
+	}
+
 	//Computes the case KL divergence or conviction for each case in entities_to_compute
 	//if normalize_convictions is false, it will return the kl divergences, if true, it will return the convictions
 	//if conviction_of_removal is true, then it will compute the conviction as if the entities not in base_group_entities were removed,
@@ -226,103 +376,39 @@ public:
 		buffers->baseDistanceProbabilities.clear();
 		ConvertDistanceContributionsToProbabilities(buffers->baseDistanceContributions, contrib_sum, buffers->baseDistanceProbabilities);
 
-		//cache constants for expected values
-		const size_t num_relevant_entities = knnCache->GetNumRelevantEntities();
-		const double probability_mass_of_non_holdouts = (1.0 - 1.0 / num_relevant_entities);
-		// the reciprocal of the ratio of num cases without to num cases with times the contrib_sum; cached for scaling below
-		// using the reciprocal here (instead of the more intuitive flip) saves a negation in the loop
-		const double updated_contrib_to_contrib_scale_inverse = num_relevant_entities / (contrib_sum * (num_relevant_entities - 1));
+		auto &base_contribs = buffers->baseDistanceContributions;
+		auto &base_probabilities = buffers->baseDistanceProbabilities;
+		auto compute_kl_divergence = [&base_contribs, &base_probabilities, contrib_sum, conviction_of_removal]
+			(ConvictionProcessor &processor, EntityReference entity_reference, size_t distance_contribution_index)
+			{
+				return processor.ComputeCaseKLDivergence(entity_reference, distance_contribution_index,
+					base_contribs, base_probabilities, contrib_sum, conviction_of_removal);
+			};
 
-		//for measuring kl divergence, only need to measure those entities that have a value that is different
-		auto &updated_distance_contribs = buffers->updatedDistanceContribs;
 		convictions_out.clear();
-		convictions_out.reserve(num_relevant_entities);
+	#ifdef MULTITHREAD_SUPPORT
+		if(!ComputeValuesConcurrently(entities_to_compute, convictions_out, compute_kl_divergence))
+	#endif
+		{
+			convictions_out.reserve(entities_to_compute.size());
+			size_t distance_contribution_index = 0;
+			for(auto entity_reference : entities_to_compute)
+				convictions_out.push_back(compute_kl_divergence(*this, entity_reference, distance_contribution_index++));
+		}
+
+		//sum in order so the result does not depend on concurrency
 		double kl_sum = 0.0;
 		bool has_zero_kl = false; //flag will be set to true if there are any convictions that are 0, used later to prevent division by 0
-
-		//compute the scaled distance contributions and sums when any 1 case is removed from the model
-		//note that the kl_divergence for every non-scaled set is 0, so the sum will not change except for when a case is actually removed from the model
-		size_t distance_contribution_index = 0;
-		for(auto entity_reference : entities_to_compute)
+		for(auto &kld : convictions_out)
 		{
-			//compute distance contributions of the entities whose dcs will be changed by the removal of entity_reference
-			updated_distance_contribs.clear();
-			double updated_contrib_sum = 0.0;
-			buffers->neighbors.clear();
-			UpdateDistanceContributionsWithHoldout(entity_reference, 1.0 / num_relevant_entities, buffers->baseDistanceContributions, contrib_sum,
-				buffers->updatedDistanceContribs, updated_contrib_sum);
-
-			//convert updated_distance_contribs to probabilities
-			//convert via the updated contribution sum and multiply by the probability mass of everything that isn't the holdout
-			//multiplying a non-held out distance contribution by this value converts it into a probability
-			double updated_dc_to_probability = probability_mass_of_non_holdouts / updated_contrib_sum;
-
-			//convert updated distance contribution into a probability as appropriate
-			for(auto &dc : updated_distance_contribs)
-			{
-				//the knockout case was already already assigned the probability
-				if(dc.reference != distance_contribution_index)
-					dc.distance *= updated_dc_to_probability;
-			}
-
-			//compute KL divergence for the values which have different neighbor lists
-
-			//need to compute the KL divergence for the cases that don't have different neighbor lists but are only scaled
-			//for conviction_of_removal, this can be computed as
-			//d_KL = sum_i -base_distance_probabilities[i] * log( base_distance_probabilities[i] / new_probabilities[i])
-			//but because we know new_probabilities[i] = base_distance_probabilities[i] * dc_update_scale we can rewrite this as:
-			// d_KL = sum_i -base_distance_probabilities[i] * log( 1 / dc_update_scale) )
-			//the logarithm doesn't change and can be pulled out of the sum (pulling out the reciprocal as -1) to be:
-			// d_KL = log( dc_update_scale) ) * sum_i base_distance_probabilities[i]
-			//but because we've already computed the kl divergence for the updated_distance_contribs (changed neighbor sets),
-			// we only want to compute d_KL for those that just need to be scaled
-			//for the opposite, the conviction of adding the case, we just flip p and q in the kl divergence:
-			// d_KL = sum_i -new_probabilities[i] * log( new_probabilities[i] / base_distance_probabilities[i] )
-			//thus (note the negative sign due to the reciprocal of dc_update_scale):
-			// d_KL = sum_i -new_probabilities[i] * log( dc_update_scale) )
-			double dc_update_scale = updated_contrib_sum * updated_contrib_to_contrib_scale_inverse;
-
-			double kld_updated;
-			double kld_scaled;
-			if(conviction_of_removal)
-			{
-				kld_updated = PartialKullbackLeiblerDivergenceFromIndices(buffers->baseDistanceProbabilities, updated_distance_contribs);
-
-				//need to find unchanged distance contribution relative to the total in order to find the total probability mass
-				double total_distance_contribution_unchanged = contrib_sum;
-				for(auto &dc : updated_distance_contribs)
-					total_distance_contribution_unchanged -= buffers->baseDistanceContributions[dc.reference];
-
-				double total_probability_mass_changed = (total_distance_contribution_unchanged / contrib_sum);
-
-				kld_scaled = total_probability_mass_changed * std::log(dc_update_scale);
-			}
-			else
-			{
-				kld_updated = PartialKullbackLeiblerDivergenceFromIndices(updated_distance_contribs, buffers->baseDistanceProbabilities);
-
-				//since the updated distance contribs have already been converted to probabilities, can just use them directly
-				double total_updated_probability_mass_changed = 1.0;
-				for(auto &dc : updated_distance_contribs)
-					total_updated_probability_mass_changed -= dc.distance;
-
-				//negative sign due to the reciprocal of dc_update_scale
-				kld_scaled = -total_updated_probability_mass_changed * std::log(dc_update_scale);
-			}
-
-			double kld_total = kld_updated + kld_scaled;
-
 			//can't be negative, so clamp to zero
-			if(kld_total >= 0.0)
-				kl_sum += kld_total;
+			if(kld >= 0.0)
+				kl_sum += kld;
 			else
 			{
-				kld_total = 0.0;
+				kld = 0.0;
 				has_zero_kl = true;
 			}
-
-			convictions_out.push_back(kld_total);
-			distance_contribution_index++;
 		}
 
 		//average
@@ -411,6 +497,66 @@ public:
 
 	protected:
 
+	#ifdef MULTITHREAD_SUPPORT
+		//if running concurrently and threads are available, sets values_out to the result of calling
+		// compute_value(processor, entity_reference, index) for each entity_reference in entities concurrently
+		// in the same order as entities and returns true, where processor uses buffers specific to the thread
+		//returns false if not computed concurrently
+		template<typename EntityCollection, typename ComputeValueFunction>
+		inline bool ComputeValuesConcurrently(EntityCollection &entities, std::vector<double> &values_out,
+			ComputeValueFunction compute_value)
+		{
+			if(!runConcurrently || entities.size() < 2)
+				return false;
+
+			auto enqueue_task_lock = Concurrency::threadPool.BeginEnqueueBatchTask();
+			if(!enqueue_task_lock.AreThreadsAvailable())
+				return false;
+
+			values_out.resize(entities.size());
+			ThreadPool::CountableTaskSet task_set(entities.size());
+
+			size_t index = 0;
+			for(auto entity_reference : entities)
+			{
+				Concurrency::threadPool.BatchEnqueueTask(
+					[this, entity_reference, index, &values_out, &compute_value, &task_set]
+					{
+						ConvictionProcessor thread_processor(*this);
+						thread_processor.buffers = &threadBuffers;
+						values_out[index] = compute_value(thread_processor, entity_reference, index);
+						task_set.MarkTaskCompleted();
+					}
+				);
+				index++;
+			}
+
+			enqueue_task_lock.Unlock();
+
+			Concurrency::threadPool.ChangeCurrentThreadStateFromActiveToWaiting();
+			task_set.WaitForTasks();
+			Concurrency::threadPool.ChangeCurrentThreadStateFromWaitingToActive();
+
+			return true;
+		}
+
+		//caches the nearest neighbors of the entities in block concurrently, writes their distance contributions
+		// to contribs_out starting at out_index, then frees the cached neighbors and clears block
+		inline void ComputeDistanceContributionsForBlock(std::vector<EntityReference> &block,
+			std::vector<double> &contribs_out, size_t &out_index)
+		{
+			knnCache->PreCacheKnn(block, numNearestNeighbors, true);
+
+			for(auto entity_reference : block)
+			{
+				contribs_out[out_index++] = ComputeDistanceContribution(entity_reference);
+				knnCache->ClearCachedKnn(entity_reference);
+			}
+
+			block.clear();
+		}
+	#endif
+
 		KnnCache *knnCache;
 		EntityQueriesStatistics::DistanceTransform<EntityReference> *distanceTransform;
 
@@ -423,6 +569,11 @@ public:
 		//reusable memory buffers
 		ConvictionProcessorBuffers *buffers;
 
+	#ifdef MULTITHREAD_SUPPORT
+		//reusable memory buffers for each thread when computing concurrently
+		static inline thread_local ConvictionProcessorBuffers threadBuffers;
+	#endif
+
 	#ifdef MULTITHREAD_SUPPORT
 		//if true, attempt to run with concurrency
 		bool runConcurrently;
@@ -206,6 +206,11 @@ public:
 	{
 		inversePValue = 1.0 / pValue;
 
+		//reranking relies on the error bound of low accuracy terms, so if it does not hold,
+		// fall back to recomputing the precise distances of the candidates
+		if(rerankAccurateDistances && !IsApproximateDistanceTermErrorBounded())
+			rerankAccurateDistances = false;
+
 		if(NeedToPrecomputeApproximate())
 		{
 			fastPowP = RepeatedFastPow(pValue);
@@ -908,6 +913,54 @@ public:
 		return (highAccuracyDistances || recomputeAccurateDistances);
 	}
 
+	//returns true if nearest neighbor candidates are found with low accuracy and then reranked with high accuracy
+	constexpr bool NeedToRerankAccurateDistances()
+	{
+		return (rerankAccurateDistances && recomputeAccurateDistances && !highAccuracyDistances);
+	}
+
+	//returns the largest low accuracy exponentiated distance an entity may have and still be nearer by high accuracy
+	// than an entity with low accuracy exponentiated distance worst_candidate_distance
+	//if reranking, an entity with true distance d has low accuracy distance within [d(1 - e), d(1 + e)], where e is
+	// the maximum relative error, so any entity that may be nearer has a low accuracy distance of at most
+	// worst_candidate_distance (1 + e) / (1 - e)
+	constexpr double GetNearestCandidateRejectDistance(double worst_candidate_distance)
+	{
+		if(!NeedToRerankAccurateDistances())
+			return worst_candidate_distance;
+		return worst_candidate_distance * (1 + approximateDistanceTermMaxRelativeError) / (1 - approximateDistanceTermMaxRelativeError);
+	}
+
+	//returns max_dist exponentiated for comparing against candidate distances
+	//if reranking, it is exponentiated with high accuracy and widened by the maximum error of
+	// low accuracy distance terms, so no entity within max_dist is excluded by the error
+	__forceinline double GetCandidateExponentiatedDistanceBound(double max_dist, bool high_accuracy)
+	{
+		if(!NeedToRerankAccurateDistances())
+			return ExponentiateDifferenceTerm(max_dist, high_accuracy);
+		return ExponentiateDifferenceTerm(max_dist, true) * (1 + approximateDistanceTermMaxRelativeError);
+	}
+
+	//returns true if every low accuracy distance term is within approximateDistanceTermMaxRelativeError
+	// of its high accuracy value
+	//the bound only describes FastPow with a positive exponent; deviations and surprisal use approximate
+	// exponentials and constants whose error is absolute, and the terms are multiplied when p is 0
+	inline bool IsApproximateDistanceTermErrorBounded()
+	{
+		if(computeSurprisal || !(pValue > 0))
+			return false;
+
+		for(auto &feature_attribs : featureAttribs)
+		{
+			if(feature_attribs.DoesFeatureHaveDeviation()
+					|| feature_attribs.nominalNumberSparseDeviationMatrix.size() > 0
+					|| feature_attribs.nominalStringSparseDeviationMatrix.size() > 0)
+				return false;
+		}
+
+		return true;
+	}
+
 protected:
 
 	//computes and caches symmetric nominal and uncertainty distance terms
@@ -1006,6 +1059,16 @@ public:
 	//if true, then estimates should be computed with low accuracy, but final results with high accuracy
 	// if false, will reuse accuracy from estimates
 	bool recomputeAccurateDistances;
+	//if true and recomputeAccurateDistances is true, then nearest neighbor candidates are found with low accuracy,
+	// keeping every entity that could be among the nearest given the maximum low accuracy error,
+	// and are reranked with high accuracy
+	bool rerankAccurateDistances;
+
+	//maximum relative error of a low accuracy distance term compared to its high accuracy value,
+	// as measured for FastPow across bases and positive exponents; the low accuracy exponentiated sum of terms
+	// has the same bound because every term is nonnegative
+	//only valid when IsApproximateDistanceTermErrorBounded returns true
+	static constexpr double approximateDistanceTermMaxRelativeError = 0.0625;
 };
 
 //base data struct for holding distance parameters and metadata
@@ -1,5 +1,15 @@
 #pragma once
 
+//system headers:
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
 ////////////////////
 // Defines hash set types in a generic way so they can be easily changed
 // * * * Profile and choose whichever works fastest and with least memory  * * *
@@ -79,3 +89,335 @@ public:
 			return this->emplace_back(key, std::forward<Args>(args)...);
 	}
 };
+
+//implements a map with all entries stored contiguously in a flat array, which is searched linearly
+//while the map is small and is indexed by an open addressing hash table of entry positions once
+//the number of entries exceeds linear_search_threshold
+//this keeps small maps, such as records with only a few keys, compact and fast to iterate,
+//while still providing constant time lookup for larger maps
+//keys and values must be trivially copyable, so entries need no destruction, and the object itself is the size of 3 pointers
+//iteration is in insertion order until an entry is erased, which moves the last entry into its place
+//note that, like other fast maps, iterators may be invalidated when the map is altered
+template<typename K, typename V, typename H = std::hash<K>, typename E = std::equal_to<K>,
+	size_t linear_search_threshold = 16>
+class FlatHybridHashMap
+{
+public:
+
+	using key_type = K;
+	using mapped_type = V;
+	using value_type = std::pair<K, V>;
+	using size_type = size_t;
+	using iterator = value_type *;
+	using const_iterator = const value_type *;
+
+	static_assert(std::is_trivially_copyable<K>::value && std::is_trivially_copyable<V>::value,
+		"FlatHybridHashMap requires trivially copyable keys and values");
+
+	inline FlatHybridHashMap()
+		: entries(nullptr), numEntries(0), entriesCapacity(0), index(nullptr)
+	{	}
+
+	inline FlatHybridHashMap(const FlatHybridHashMap &other)
+		: FlatHybridHashMap()
+	{
+		*this = other;
+	}
+
+	inline FlatHybridHashMap(FlatHybridHashMap &&other) noexcept
+		: entries(other.entries), numEntries(other.numEntries),
+		entriesCapacity(other.entriesCapacity), index(other.index)
+	{
+		other.entries = nullptr;
+		other.numEntries = 0;
+		other.entriesCapacity = 0;
+		other.index = nullptr;
+	}
+
+	inline ~FlatHybridHashMap()
+	{
+		::operator delete(entries);
+		std::free(index);
+	}
+
+	inline FlatHybridHashMap &operator=(const FlatHybridHashMap &other)
+	{
+		if(this == &other)
+			return *this;
+
+		clear();
+		reserve(other.numEntries);
+		std::uninitialized_copy(other.entries, other.entries + other.numEntries, entries);
+		numEntries = other.numEntries;
+		RebuildIndex();
+		return *this;
+	}
+
+	inline FlatHybridHashMap &operator=(FlatHybridHashMap &&other) noexcept
+	{
+		swap(other);
+		return *this;
+	}
+
+	inline void swap(FlatHybridHashMap &other) noexcept
+	{
+		std::swap(entries, other.entries);
+		std::swap(numEntries, other.numEntries);
+		std::swap(entriesCapacity, other.entriesCapacity);
+		std::swap(index, other.index);
+	}
+
+	inline iterator begin()
+	{	return entries;	}
+	inline iterator end()
+	{	return entries + numEntries;	}
+	inline const_iterator begin() const
+	{	return entries;	}
+	inline const_iterator end() const
+	{	return entries + numEntries;	}
+	inline const_iterator cbegin() const
+	{	return entries;	}
+	inline const_iterator cend() const
+	{	return entries + numEntries;	}
+
+	inline size_t size() const
+	{	return numEntries;	}
+
+	inline bool empty() const
+	{	return numEntries == 0;	}
+
+	//removes all entries but keeps the allocated memory
+	inline void clear()
+	{
+		numEntries = 0;
+		if(index != nullptr)
+			std::memset(index + 1, 0, GetNumIndexSlots() * sizeof(uint32_t));
+	}
+
+	//makes sure there is space for at least num_entries
+	inline void reserve(size_t num_entries)
+	{
+		if(num_entries > entriesCapacity)
+			Reallocate(num_entries);
+	}
+
+	inline iterator find(const K &key)
+	{
+		return entries + FindPosition(key);
+	}
+
+	inline const_iterator find(const K &key) const
+	{
+		return entries + FindPosition(key);
+	}
+
+	inline size_t count(const K &key) const
+	{
+		return FindPosition(key) < numEntries ? 1 : 0;
+	}
+
+	//inserts value if its key is not already present
+	//returns an iterator to the entry with the key and true if it was inserted
+	inline std::pair<iterator, bool> insert(const value_type &value)
+	{
+		return emplace(value.first, value.second);
+	}
+
+	//inserts the key with the value constructed from args if the key is not already present
+	//returns an iterator to the entry with the key and true if it was inserted
+	template<class... Args>
+	inline std::pair<iterator, bool> emplace(const K &key, Args&&... args)
+	{
+		size_t pos = FindPosition(key);
+		if(pos < numEntries)
+			return std::make_pair(entries + pos, false);
+
+		if(numEntries == entriesCapacity)
+			Reallocate(entriesCapacity < 4 ? 4 : 2 * entriesCapacity);
+
+		pos = numEntries++;
+		new (entries + pos) value_type(key, V(std::forward<Args>(args)...));
+
+		if(index != nullptr)
+			InsertIntoIndex(pos);
+		else if(numEntries > linear_search_threshold)
+			RebuildIndex();
+
+		return std::make_pair(entries + pos, true);
+	}
+
+	template<class... Args>
+	inline std::pair<iterator, bool> try_emplace(const K &key, Args&&... args)
+	{
+		return emplace(key, std::forward<Args>(args)...);
+	}
+
+	inline V &operator[](const K &key)
+	{
+		return emplace(key).first->second;
+	}
+
+	//removes the entry with key, returns the number of entries removed
+	inline size_t erase(const K &key)
+	{
+		size_t pos = FindPosition(key);
+		if(pos >= numEntries)
+			return 0;
+		ErasePosition(pos);
+		return 1;
+	}
+
+	//removes the entry at it, returns an iterator to the entry that took its place
+	inline iterator erase(const_iterator it)
+	{
+		size_t pos = static_cast<size_t>(it - entries);
+		ErasePosition(pos);
+		return entries + pos;
+	}
+
+protected:
+
+	//returns the number of slots in the index, assumes index is not nullptr
+	inline size_t GetNumIndexSlots() const
+	{
+		return static_cast<size_t>(1) << index[0];
+	}
+
+	//returns the slot in the index where the search for key begins, assumes index is not nullptr
+	inline size_t GetHomeSlot(const K &key) const
+	{
+		//fibonacci hashing to spread out keys such as aligned pointers
+		uint64_t hash = static_cast<uint64_t>(H{}(key)) * 11400714819323198485ull;
+		return static_cast<size_t>(hash >> (64 - index[0]));
+	}
+
+	//returns the position of key within entries, numEntries if not found
+	inline size_t FindPosition(const K &key) const
+	{
+		if(index == nullptr)
+		{
+			for(size_t i = 0; i < numEntries; i++)
+			{
+				if(E{}(entries[i].first, key))
+					return i;
+			}
+			return numEntries;
+		}
+
+		size_t mask = GetNumIndexSlots() - 1;
+		uint32_t *slots = index + 1;
+		for(size_t slot = GetHomeSlot(key); slots[slot] != 0; slot = (slot + 1) & mask)
+		{
+			size_t pos = slots[slot] - 1;
+			if(E{}(entries[pos].first, key))
+				return pos;
+		}
+		return numEntries;
+	}
+
+	//returns the slot in the index that holds position pos, assumes it is present
+	inline size_t FindSlotOfPosition(size_t pos) const
+	{
+		size_t mask = GetNumIndexSlots() - 1;
+		uint32_t *slots = index + 1;
+		size_t slot = GetHomeSlot(entries[pos].first);
+		while(slots[slot] != pos + 1)
+			slot = (slot + 1) & mask;
+		return slot;
+	}
+
+	//adds the entry at pos to the index, assumes index is not nullptr
+	inline void InsertIntoIndex(size_t pos)
+	{
+		size_t mask = GetNumIndexSlots() - 1;
+		uint32_t *slots = index + 1;
+		size_t slot = GetHomeSlot(entries[pos].first);
+		while(slots[slot] != 0)
+			slot = (slot + 1) & mask;
+		slots[slot] = static_cast<uint32_t>(pos + 1);
+	}
+
+	//removes the entry at pos, moving the last entry into its place
+	inline void ErasePosition(size_t pos)
+	{
+		size_t last = numEntries - 1;
+		if(index != nullptr)
+		{
+			//remove the slot for pos, shifting back any following entries in the probe sequence
+			size_t mask = GetNumIndexSlots() - 1;
+			uint32_t *slots = index + 1;
+			size_t empty_slot = FindSlotOfPosition(pos);
+			slots[empty_slot] = 0;
+			for(size_t slot = (empty_slot + 1) & mask; slots[slot] != 0; slot = (slot + 1) & mask)
+			{
+				size_t home = GetHomeSlot(entries[slots[slot] - 1].first);
+				//only move the entry back if its home is not cyclically within (empty_slot, slot]
+				bool home_in_range = (empty_slot <= slot)
+					? (empty_slot < home && home <= slot)
+					: (empty_slot < home || home <= slot);
+				if(!home_in_range)
+				{
+					slots[empty_slot] = slots[slot];
+					slots[slot] = 0;
+					empty_slot = slot;
+				}
+			}
+
+			if(pos != last)
+				slots[FindSlotOfPosition(last)] = static_cast<uint32_t>(pos + 1);
+		}
+
+		if(pos != last)
+			entries[pos] = entries[last];
+		numEntries--;
+	}
+
+	//resizes the entries to hold new_capacity, and rebuilds the index if needed
+	inline void Reallocate(size_t new_capacity)
+	{
+		value_type *new_entries = static_cast<value_type *>(::operator new(new_capacity * sizeof(value_type)));
+		std::uninitialized_move(entries, entries + numEntries, new_entries);
+		::operator delete(entries);
+		entries = new_entries;
+		entriesCapacity = static_cast<uint32_t>(new_capacity);
+
+		if(index != nullptr || numEntries > linear_search_threshold)
+			RebuildIndex();
+	}
+
+	//builds the index for all entries if the number of entries exceeds linear_search_threshold,
+	// sized to keep the load factor at most one half of the capacity of entries
+	inline void RebuildIndex()
+	{
+		if(numEntries <= linear_search_threshold && index == nullptr)
+			return;
+
+		uint32_t num_bits = 1;
+		while((static_cast<size_t>(1) << num_bits) < 2 * static_cast<size_t>(entriesCapacity))
+			num_bits++;
+
+		if(index == nullptr || index[0] != num_bits)
+		{
+			std::free(index);
+			index = static_cast<uint32_t *>(std::malloc((1 + (static_cast<size_t>(1) << num_bits)) * sizeof(uint32_t)));
+			if(index == nullptr)
+				throw std::bad_alloc();
+			index[0] = num_bits;
+		}
+
+		std::memset(index + 1, 0, GetNumIndexSlots() * sizeof(uint32_t));
+		for(size_t i = 0; i < numEntries; i++)
+			InsertIntoIndex(i);
+	}
+
+	//contiguous storage of all entries
+	value_type *entries;
+
+	//number of entries in use and number allocated
+	uint32_t numEntries;
+	uint32_t entriesCapacity;
+
+	//when not nullptr, index[0] is the number of bits of the number of slots,
+	// and the slots follow, each holding an entry position plus one, or zero if empty
+	uint32_t *index;
+};
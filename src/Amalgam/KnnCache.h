@@ -5,8 +5,13 @@
 #include "SeparableBoxFilterDataStore.h"
 
 //system headers:
+#include <algorithm>
 #include <vector>
 
+//maximum number of bytes of nearest neighbor results to cache at once when results for each entity
+// are only needed briefly, such as when computing distance contributions
+extern size_t _knn_cache_memory_budget;
+
 //caches nearest neighbor results for every entity in the provided data structure
 // will attempt to find nonzero distances whenever possible and will expand the search out as far as it can in its attempt
 class KnnNonZeroDistanceQuerySBFCache
@@ -35,21 +40,36 @@ public:
 	//gets the nearest neighbors to the index and caches them
 	//this may expand k so that at least one non-zero distance is returned - if that is not possible then it will return all entities
 #ifdef MULTITHREAD_SUPPORT
-	void PreCacheAllKnn(size_t top_k, bool run_concurrently)
+	inline void PreCacheAllKnn(size_t top_k, bool run_concurrently)
+	{
+		PreCacheKnn(*relevantIndices, top_k, run_concurrently);
+	}
 #else
-	void PreCacheAllKnn(size_t top_k)
+	inline void PreCacheAllKnn(size_t top_k)
+	{
+		PreCacheKnn(*relevantIndices, top_k);
+	}
+#endif
+
+	//like PreCacheAllKnn, but only caches the nearest neighbors for each index in indices
+#ifdef MULTITHREAD_SUPPORT
+	template<typename IndexCollection>
+	void PreCacheKnn(IndexCollection &indices, size_t top_k, bool run_concurrently)
+#else
+	template<typename IndexCollection>
+	void PreCacheKnn(IndexCollection &indices, size_t top_k)
 #endif
 	{
 
 	#ifdef MULTITHREAD_SUPPORT
-		if(run_concurrently && relevantIndices->size() > 1)
+		if(run_concurrently && indices.size() > 1)
 		{
 			auto enqueue_task_lock = Concurrency::threadPool.BeginEnqueueBatchTask();
 			if(enqueue_task_lock.AreThreadsAvailable())
 			{
-				ThreadPool::CountableTaskSet task_set(relevantIndices->size());
+				ThreadPool::CountableTaskSet task_set(indices.size());
 			
-				for(auto index : *relevantIndices)
+				for(auto index : indices)
 				{
 					//fill in cache entry if it is not sufficient
 					if(top_k > cachedNeighbors[index].size())
@@ -78,7 +98,7 @@ public:
 		//not running concurrently
 	#endif
 
-		for(auto index : *relevantIndices)
+		for(auto index : indices)
 		{
 			//fill in cache entry if it is not sufficient
 			if(top_k > cachedNeighbors[index].size())
@@ -90,6 +110,20 @@ public:
 		}
 	}
 
+	//frees the nearest neighbors cached for index
+	inline void ClearCachedKnn(size_t index)
+	{
+		std::vector<DistanceReferencePair<size_t>>().swap(cachedNeighbors[index]);
+	}
+
+	//returns the number of entities whose top_k nearest neighbors can be cached at once within _knn_cache_memory_budget
+	static inline size_t GetMaxNumEntitiesToCache(size_t top_k)
+	{
+		//include one additional neighbor for expanding to the first nonzero distance
+		size_t bytes_per_entity = (top_k + 1) * sizeof(DistanceReferencePair<size_t>);
+		return std::max<size_t>(_knn_cache_memory_budget / bytes_per_entity, 1);
+	}
+
 	//returns true if the cached entities nearest to index contain other_index within top_k
 	bool DoesCachedKnnContainEntity(size_t index, size_t other_index, size_t top_k)
 	{
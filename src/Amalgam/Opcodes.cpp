@@ -256,6 +256,7 @@ void StringInternPool::InitializeStaticStrings()
 	//entity query
 	EmplaceNodeTypeString(ENT_CONTAINED_ENTITIES, "contained_entities");
 	EmplaceNodeTypeString(ENT_COMPUTE_ON_CONTAINED_ENTITIES, "compute_on_contained_entities");
+	EmplaceNodeTypeString(ENT_CACHE_CONTAINED_ENTITY_LABELS, "cache_contained_entity_labels");
 	EmplaceNodeTypeString(ENT_QUERY_COUNT, "query_count");
 	EmplaceNodeTypeString(ENT_QUERY_SELECT, "query_select");
 	EmplaceNodeTypeString(ENT_QUERY_SAMPLE, "query_sample");
@@ -300,6 +301,7 @@ void StringInternPool::InitializeStaticStrings()
 	EmplaceNodeTypeString(ENT_CALL_ENTITY, "call_entity");
 	EmplaceNodeTypeString(ENT_CALL_ENTITY_GET_CHANGES, "call_entity_get_changes");
 	EmplaceNodeTypeString(ENT_CALL_CONTAINER, "call_container");
+	EmplaceNodeTypeString(ENT_CALL_ON_CONTAINED_ENTITIES, "call_on_contained_entities");
 
 	//end opcodes
 
@@ -351,6 +353,7 @@ void StringInternPool::InitializeStaticStrings()
 	EmplaceStaticString(ENBISI_precise, "precise");
 	EmplaceStaticString(ENBISI_fast, "fast");
 	EmplaceStaticString(ENBISI_recompute_precise, "recompute_precise");
+	EmplaceStaticString(ENBISI_rerank_precise, "rerank_precise");
 
 	//format opcode types
 	EmplaceStaticString(ENBISI_code, "code");
@@ -237,6 +237,7 @@ enum EvaluableNodeType : uint8_t
 	//entity query
 	ENT_CONTAINED_ENTITIES,
 	ENT_COMPUTE_ON_CONTAINED_ENTITIES,
+	ENT_CACHE_CONTAINED_ENTITY_LABELS,
 	ENT_QUERY_SELECT,
 	ENT_QUERY_SAMPLE,
 	ENT_QUERY_WEIGHTED_SAMPLE,
@@ -281,6 +282,7 @@ enum EvaluableNodeType : uint8_t
 	ENT_CALL_ENTITY,
 	ENT_CALL_ENTITY_GET_CHANGES,
 	ENT_CALL_CONTAINER,
+	ENT_CALL_ON_CONTAINED_ENTITIES,
 
 	//not in active memory
 	//freed and no longer in use
@@ -338,7 +340,7 @@ constexpr OrderedChildNodeType GetInstructionOrderedChildNodeType(EvaluableNodeT
 	case ENT_ASSIGN_ENTITY_ROOTS:	case ENT_ACCUM_ENTITY_ROOTS:
 	case ENT_SET_ENTITY_RAND_SEED:
 	case ENT_CREATE_ENTITIES:
-	case ENT_CONTAINED_ENTITIES:	case ENT_COMPUTE_ON_CONTAINED_ENTITIES:
+	case ENT_CONTAINED_ENTITIES:	case ENT_COMPUTE_ON_CONTAINED_ENTITIES:					case ENT_CACHE_CONTAINED_ENTITY_LABELS:
 	case ENT_QUERY_SELECT:			case ENT_QUERY_SAMPLE:									case ENT_QUERY_WEIGHTED_SAMPLE:
 	case ENT_QUERY_IN_ENTITY_LIST:	case ENT_QUERY_NOT_IN_ENTITY_LIST:						case ENT_QUERY_COUNT:
 	case ENT_QUERY_EXISTS:			case ENT_QUERY_NOT_EXISTS:
@@ -357,6 +359,7 @@ constexpr OrderedChildNodeType GetInstructionOrderedChildNodeType(EvaluableNodeT
 	case ENT_CONTAINS_LABEL:		case ENT_ASSIGN_TO_ENTITIES:							case ENT_DIRECT_ASSIGN_TO_ENTITIES:
 	case ENT_ACCUM_TO_ENTITIES:		case ENT_RETRIEVE_FROM_ENTITY:							case ENT_DIRECT_RETRIEVE_FROM_ENTITY:
 	case ENT_CALL_ENTITY:			case ENT_CALL_ENTITY_GET_CHANGES:						case ENT_CALL_CONTAINER:
+	case ENT_CALL_ON_CONTAINED_ENTITIES:
 		return OCNT_ORDERED;
 
 	case ENT_WHILE:					case ENT_LET:				case ENT_DECLARE:			case ENT_SUBTRACT:
@@ -472,6 +475,7 @@ constexpr bool DoesEvaluableNodeTypeCreateScope(EvaluableNodeType t)
 		|| t == ENT_RANGE || t == ENT_REWRITE || t == ENT_MAP || t == ENT_FILTER || t == ENT_WEAVE
 		|| t == ENT_REDUCE || t == ENT_SORT || t == ENT_ASSOCIATE || t == ENT_ZIP || t == ENT_LIST
 		|| t == ENT_ASSOC || t == ENT_CALL_ENTITY || t == ENT_CALL_ENTITY_GET_CHANGES || t == ENT_CALL_CONTAINER
+		|| t == ENT_CALL_ON_CONTAINED_ENTITIES
 		);
 }
 
@@ -566,6 +570,7 @@ enum EvaluableNodeBuiltInStringId
 	ENBISI_precise,
 	ENBISI_fast,
 	ENBISI_recompute_precise,
+	ENBISI_rerank_precise,
 
 	//format opcode types
 	ENBISI_code,
@@ -564,11 +564,16 @@ EvaluableNode *Parser::ParseNextBlock()
 			if(cur_node == nullptr)
 				return nullptr;
 
+			MovePendingChildNodesIntoNode(cur_node);
+
 			const auto &parent = parentNodes.find(cur_node);
 
 			//if no parent, then all finished
 			if(parent == end(parentNodes) || parent->second == nullptr)
+			{
+				MoveAllPendingChildNodesIntoNodes();
 				return tree_top;
+			}
 
 			//jump up to the parent node
 			cur_node = parent->second;
@@ -581,12 +586,17 @@ EvaluableNode *Parser::ParseNextBlock()
 			{
 				tree_top = n;
 				cur_node = n;
+				if(n->IsOrderedArray())
+					openOrderedNodes.emplace_back(n, pendingChildNodes.size());
 				continue;
 			}
 
 			if(cur_node->IsOrderedArray())
 			{
-				cur_node->AppendOrderedChildNode(n);
+				if(!openOrderedNodes.empty() && openOrderedNodes.back().first == cur_node)
+					pendingChildNodes.push_back(n);
+				else
+					cur_node->AppendOrderedChildNode(n);
 			}
 			else if(cur_node->IsAssociativeArray())
 			{
@@ -632,7 +642,10 @@ EvaluableNode *Parser::ParseNextBlock()
 
 					//if no parent, then all finished
 					if(parent == end(parentNodes) || parent->second == nullptr)
+					{
+						MoveAllPendingChildNodesIntoNodes();
 						return tree_top;
+					}
 
 					//jump up to the parent node
 					cur_node = parent->second;
@@ -653,13 +666,34 @@ EvaluableNode *Parser::ParseNextBlock()
 				if(!originalSource.empty())
 					std::cerr << "Warning: "  << " Invalid opcode at line " << lineNumber + 1 << " of " << originalSource << std::endl;
 			}
+
+			if(cur_node == n && n->IsOrderedArray())
+				openOrderedNodes.emplace_back(n, pendingChildNodes.size());
 		}
 
 	}
 
+	MoveAllPendingChildNodesIntoNodes();
 	return tree_top;
 }
 
+void Parser::MovePendingChildNodesIntoNode(EvaluableNode *node)
+{
+	if(openOrderedNodes.empty() || openOrderedNodes.back().first != node)
+		return;
+
+	size_t start = openOrderedNodes.back().second;
+	openOrderedNodes.pop_back();
+
+	auto first_child = begin(pendingChildNodes) + start;
+	auto &ocn = node->GetOrderedChildNodesReference();
+	ocn.reserve(ocn.size() + (end(pendingChildNodes) - first_child));
+	for(auto it = first_child; it != end(pendingChildNodes); ++it)
+		node->AppendOrderedChildNode(*it);
+
+	pendingChildNodes.erase(first_child, end(pendingChildNodes));
+}
+
 void Parser::AppendComments(EvaluableNode *n, size_t indentation_depth, bool pretty, std::string &to_append)
 {
 	const auto comment_lines = n->GetCommentsSeparateLines();
@@ -172,6 +172,17 @@ protected:
 	//Parses the next block of code, then returns the block
 	EvaluableNode *ParseNextBlock();
 
+	//if node is the innermost open ordered node, moves its pending child nodes into it
+	// with a single allocation of exactly the needed size
+	void MovePendingChildNodesIntoNode(EvaluableNode *node);
+
+	//calls MovePendingChildNodesIntoNode for every ordered node that is still open
+	inline void MoveAllPendingChildNodesIntoNodes()
+	{
+		while(!openOrderedNodes.empty())
+			MovePendingChildNodesIntoNode(openOrderedNodes.back().first);
+	}
+
 	//Prints out all comments for the respective node
 	static void AppendComments(EvaluableNode *n, size_t indentation_depth, bool pretty, std::string &to_append);
 
@@ -223,6 +234,13 @@ protected:
 	//parentNodes contains each reference as the key and the parent as the value
 	EvaluableNode::ReferenceAssocType parentNodes;
 
+	//child nodes of the currently open ordered nodes, accumulated until each node is closed
+	// so that each node's child nodes can be allocated once at their final size
+	std::vector<EvaluableNode *> pendingChildNodes;
+
+	//each currently open ordered node and the position in pendingChildNodes where its child nodes begin
+	std::vector<std::pair<EvaluableNode *, size_t>> openOrderedNodes;
+
 	EvaluableNodeManager *evaluableNodeManager;
 
 	//character used for indendation
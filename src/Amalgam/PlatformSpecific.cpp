@@ -7,12 +7,14 @@
 #include <algorithm>
 #include <array>
 #include <cctype>
+#include <cerrno>
 #include <cfenv>
 #include <codecvt>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <fstream>
+#include <iostream>
 
 //perform universal initialization
 class PlatformSpecificStartup
@@ -60,6 +62,10 @@ PlatformSpecificStartup _platform_specific_startup;
 	#include <sys/stat.h>
 	#include <string>
 	#include <unistd.h>
+
+	#ifdef OS_LINUX
+		#include <sys/mman.h>
+	#endif
 #endif
 
 void Platform_SeparatePathFileExtension(const std::string &combined, std::string &path, std::string &base_filename, std::string &extension)
@@ -292,6 +298,94 @@ bool Platform_IsDebuggerPresent()
 	return false;
 }
 
+bool _enable_huge_pages = false;
+
+#ifdef OS_LINUX
+//unmaps num_bytes starting at start, reporting failure since the pages would otherwise leak silently
+static void UnmapPages(void *start, size_t num_bytes)
+{
+	if(munmap(start, num_bytes) != 0)
+		std::cerr << "Warning: could not unmap " << num_bytes << " bytes of memory: " << std::strerror(errno) << std::endl;
+}
+#endif
+
+void *Platform_AllocateLargeBuffer(size_t num_bytes, bool use_huge_pages)
+{
+#ifdef OS_LINUX
+	constexpr size_t huge_page_size = Platform_LargeBufferMinSize;
+	size_t size = (num_bytes + huge_page_size - 1) & ~(huge_page_size - 1);
+
+#ifdef MAP_HUGE_SHIFT
+	//explicit huge pages only succeed if the system has reserved them
+	//request the 2MB size explicitly, because the buffer is sized and unmapped in multiples of 2MB,
+	// and the default huge page size may be larger, such as 1GB
+	if(use_huge_pages)
+	{
+		constexpr int map_huge_2mb = (21 << MAP_HUGE_SHIFT);
+		void *buffer = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | map_huge_2mb, -1, 0);
+		if(buffer != MAP_FAILED)
+			return buffer;
+	}
+#endif
+
+	//reserve an extra huge page so the buffer can start on a huge page boundary,
+	// otherwise the first and last partial huge pages could not be backed by huge pages
+	void *reserved = mmap(nullptr, size + huge_page_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if(reserved == MAP_FAILED)
+		throw std::bad_alloc();
+
+	uintptr_t reserved_start = reinterpret_cast<uintptr_t>(reserved);
+	uintptr_t start = (reserved_start + huge_page_size - 1) & ~(huge_page_size - 1);
+	if(start > reserved_start)
+		UnmapPages(reserved, start - reserved_start);
+	uintptr_t reserved_end = reserved_start + size + huge_page_size;
+	if(reserved_end > start + size)
+		UnmapPages(reinterpret_cast<void *>(start + size), reserved_end - (start + size));
+
+	//if transparent huge pages are disabled, the advice fails and the buffer uses regular pages
+	if(use_huge_pages)
+		madvise(reinterpret_cast<void *>(start), size, MADV_HUGEPAGE);
+
+	return reinterpret_cast<void *>(start);
+#else
+	return ::operator new(num_bytes);
+#endif
+}
+
+void Platform_FreeLargeBuffer(void *buffer, size_t num_bytes)
+{
+#ifdef OS_LINUX
+	constexpr size_t huge_page_size = Platform_LargeBufferMinSize;
+	size_t size = (num_bytes + huge_page_size - 1) & ~(huge_page_size - 1);
+	UnmapPages(buffer, size);
+#else
+	::operator delete(buffer);
+#endif
+}
+
+size_t Platform_GetHugePageMemoryInBytes()
+{
+	size_t num_bytes = 0;
+
+#ifdef OS_LINUX
+	//sum the transparent and explicit huge page lines, which are reported in kB
+	std::ifstream smaps_file("/proc/self/smaps_rollup");
+	std::string line;
+	while(std::getline(smaps_file, line))
+	{
+		if(line.rfind("AnonHugePages:", 0) == 0 || line.rfind("Shared_Hugetlb:", 0) == 0
+				|| line.rfind("Private_Hugetlb:", 0) == 0)
+		{
+			size_t num_kilobytes = 0;
+			if(std::sscanf(line.c_str() + line.find(':') + 1, "%zu", &num_kilobytes) == 1)
+				num_bytes += num_kilobytes * 1024;
+		}
+	}
+#endif
+
+	return num_bytes;
+}
+
 std::string Platform_GetOperatingSystemName()
 {
 #ifdef OS_WINDOWS
@@ -10,6 +10,7 @@
 #include <ctime>
 #include <fstream>
 #include <iostream>
+#include <new>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -203,6 +204,70 @@ bool Platform_IsDebuggerPresent();
 //returns a string representing the name of the operating system
 std::string Platform_GetOperatingSystemName();
 
+//if true, large buffers allocated via Platform_AllocateLargeBuffer through HugePageAllocator request huge pages
+extern bool _enable_huge_pages;
+
+//buffers at least this size are allocated via Platform_AllocateLargeBuffer, the size of a huge page on common platforms
+constexpr size_t Platform_LargeBufferMinSize = 2 << 20;
+
+//allocates num_bytes for a large, long-lived buffer, aligned to a huge page where supported
+// if use_huge_pages, first attempts explicit huge pages, then falls back to advising the os to use transparent huge pages
+// throws std::bad_alloc on failure, like operator new
+void *Platform_AllocateLargeBuffer(size_t num_bytes, bool use_huge_pages);
+
+//frees a buffer of num_bytes allocated by Platform_AllocateLargeBuffer
+void Platform_FreeLargeBuffer(void *buffer, size_t num_bytes);
+
+//returns the number of bytes of memory of the process that are backed by huge pages, or 0 if not available
+size_t Platform_GetHugePageMemoryInBytes();
+
+//allocator for containers of large, long-lived data that may be randomly accessed, such as matrices,
+// which allocates buffers of at least Platform_LargeBufferMinSize via Platform_AllocateLargeBuffer
+// to reduce TLB misses when _enable_huge_pages is set
+//whether a buffer is large only depends on its size, so deallocation always matches allocation
+template<typename T>
+class HugePageAllocator
+{
+public:
+	using value_type = T;
+
+	HugePageAllocator() noexcept
+	{	}
+
+	template<typename U>
+	HugePageAllocator(const HugePageAllocator<U> &) noexcept
+	{	}
+
+	inline T *allocate(size_t n)
+	{
+		size_t num_bytes = n * sizeof(T);
+		if(num_bytes >= Platform_LargeBufferMinSize)
+			return static_cast<T *>(Platform_AllocateLargeBuffer(num_bytes, _enable_huge_pages));
+		return static_cast<T *>(::operator new(num_bytes));
+	}
+
+	inline void deallocate(T *p, size_t n) noexcept
+	{
+		size_t num_bytes = n * sizeof(T);
+		if(num_bytes >= Platform_LargeBufferMinSize)
+			Platform_FreeLargeBuffer(p, num_bytes);
+		else
+			::operator delete(p);
+	}
+
+	template<typename U>
+	constexpr bool operator==(const HugePageAllocator<U> &) const noexcept
+	{
+		return true;
+	}
+
+	template<typename U>
+	constexpr bool operator!=(const HugePageAllocator<U> &) const noexcept
+	{
+		return false;
+	}
+};
+
 #ifdef OS_MAC
 // warnings thrown on OS_MAC
 #pragma GCC diagnostic push
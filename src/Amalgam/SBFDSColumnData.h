@@ -56,6 +56,26 @@ public:
 		indexWithLargestCode(0), largestCodeSize(0)
 	{	}
 
+	//deep copies all of the data of other
+	inline SBFDSColumnData(const SBFDSColumnData &other)
+		: stringId(other.stringId), invalidIndices(other.invalidIndices), numberIndices(other.numberIndices),
+		stringIdIndices(other.stringIdIndices), nullIndices(other.nullIndices), codeIndices(other.codeIndices),
+		indexWithLongestString(other.indexWithLongestString), longestStringLength(other.longestStringLength),
+		indexWithLargestCode(other.indexWithLargestCode), largestCodeSize(other.largestCodeSize),
+		internedNumberValues(other.internedNumberValues), internedStringIdValues(other.internedStringIdValues)
+	{
+		sortedNumberValueEntries.reserve(other.sortedNumberValueEntries.size());
+		for(auto &value_entry : other.sortedNumberValueEntries)
+			sortedNumberValueEntries.emplace_back(std::make_unique<ValueEntry>(*value_entry));
+
+		stringIdValueEntries.reserve(other.stringIdValueEntries.size());
+		for(auto &[sid, value_entry] : other.stringIdValueEntries)
+			stringIdValueEntries.emplace(sid, std::make_unique<ValueEntry>(*value_entry));
+
+		for(auto &[code_size, indices] : other.valueCodeSizeToIndices)
+			valueCodeSizeToIndices.emplace(code_size, std::make_unique<SortedIntegerSet>(*indices));
+	}
+
 	//like InsertIndexValue, but used only for building the column data from an empty column
 	//this function must be called on each index in ascending order; for example, index 2 must be called after index 1
 	//inserts number values in entities_with_number_values
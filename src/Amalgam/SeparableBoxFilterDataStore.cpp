@@ -156,7 +156,7 @@ void SeparableBoxFilterDataStore::RemoveColumnIndex(size_t column_index_to_remov
 	columnData.pop_back();
 
 	//create new smaller container to hold the reduced data
-	std::vector<EvaluableNodeImmediateValue> old_matrix;
+	MatrixType old_matrix;
 	std::swap(old_matrix, matrix);
 
 	//if no columns left, then done
@@ -288,6 +288,109 @@ void SeparableBoxFilterDataStore::RemoveEntity(Entity *entity, size_t entity_ind
 #endif
 }
 
+void SeparableBoxFilterDataStore::RemoveEntities(std::vector<size_t> &entity_indices_to_remove,
+	std::vector<std::pair<size_t, size_t>> &entity_index_reassignments)
+{
+	if(columnData.size() == 0)
+		return;
+
+#ifdef SBFDS_VERIFICATION
+	VerifyAllEntitiesForAllColumns();
+#endif
+
+	size_t num_entities_removed = 0;
+	for(size_t entity_index : entity_indices_to_remove)
+	{
+		if(entity_index < numEntities)
+			num_entities_removed++;
+	}
+
+	if(num_entities_removed == 0)
+		return;
+
+	size_t new_num_entities = numEntities - num_entities_removed;
+
+	//reassigns the values of each surviving entity to its new index and removes the values of the remaining removed entities
+	// each column's data is independent of the others
+	auto remove_entities_from_column = [this, &entity_indices_to_remove, &entity_index_reassignments, new_num_entities](size_t column_index)
+	{
+		auto &column_data = columnData[column_index];
+
+		for(auto [entity_index, entity_index_to_reassign] : entity_index_reassignments)
+		{
+			if(entity_index >= numEntities || entity_index_to_reassign >= numEntities)
+				continue;
+
+			auto &val_to_overwrite = GetValue(entity_index, column_index);
+			auto type_to_overwrite = column_data->GetIndexValueType(entity_index);
+
+			auto &value_to_reassign = GetValue(entity_index_to_reassign, column_index);
+			auto value_type_to_reassign = column_data->GetIndexValueType(entity_index_to_reassign);
+
+			//change the destination to the value
+			val_to_overwrite = column_data->ChangeIndexValue(type_to_overwrite, val_to_overwrite, value_type_to_reassign, value_to_reassign, entity_index);
+
+			//remove the value where it is
+			column_data->DeleteIndexValue(value_type_to_reassign, value_to_reassign, entity_index_to_reassign);
+		}
+
+		//removed entities at or above the new number of entities were not overwritten, so remove them directly
+		for(size_t entity_index : entity_indices_to_remove)
+		{
+			if(entity_index < new_num_entities || entity_index >= numEntities)
+				continue;
+
+			auto &feature_value = GetValue(entity_index, column_index);
+			auto feature_type = column_data->GetIndexValueType(entity_index);
+			column_data->DeleteIndexValue(feature_type, feature_value, entity_index);
+		}
+	};
+
+	size_t num_columns = columnData.size();
+
+#ifdef MULTITHREAD_SUPPORT
+	//if big enough (enough entities and/or enough columns), try to use multithreading
+	if(num_columns > 1 && (num_entities_removed > 1000 || (num_entities_removed > 100 && num_columns > 10)))
+	{
+		ThreadPool::CountableTaskSet task_set(num_columns);
+
+		auto enqueue_task_lock = Concurrency::urgentThreadPool.BeginEnqueueBatchTask(false);
+		for(size_t i = 0; i < num_columns; i++)
+		{
+			Concurrency::urgentThreadPool.BatchEnqueueTask([&remove_entities_from_column, i, &task_set]()
+				{
+					remove_entities_from_column(i);
+					task_set.MarkTaskCompleted();
+				}
+			);
+		}
+		enqueue_task_lock.Unlock();
+
+		Concurrency::urgentThreadPool.ChangeCurrentThreadStateFromActiveToWaiting();
+		task_set.WaitForTasks();
+		Concurrency::urgentThreadPool.ChangeCurrentThreadStateFromWaitingToActive();
+	}
+	else //not running concurrently
+#endif
+	{
+		for(size_t i = 0; i < num_columns; i++)
+			remove_entities_from_column(i);
+	}
+
+	//truncate matrix cache to the remaining entities
+	numEntities = new_num_entities;
+	matrix.resize(numEntities * num_columns);
+
+	//clean up any labels that aren't relevant
+	RemoveAnyUnusedLabels();
+
+	OptimizeAllColumns();
+
+#ifdef SBFDS_VERIFICATION
+	VerifyAllEntitiesForAllColumns();
+#endif
+}
+
 void SeparableBoxFilterDataStore::UpdateAllEntityLabels(Entity *entity, size_t entity_index)
 {
 	if(entity_index >= numEntities)
@@ -365,6 +468,124 @@ void SeparableBoxFilterDataStore::UpdateEntityLabel(Entity *entity, size_t entit
 #endif
 }
 
+std::vector<size_t> SeparableBoxFilterDataStore::GetLocalityPreservingEntityOrder(std::vector<StringInternPool::StringID> &label_sids)
+{
+	std::vector<size_t> column_indices;
+	for(auto label_sid : label_sids)
+	{
+		size_t column_index = GetColumnIndexFromLabelId(label_sid);
+		if(column_index < columnData.size())
+			column_indices.push_back(column_index);
+	}
+
+	//each dimension gets an equal share of the bits of the 64-bit curve key
+	constexpr size_t num_key_bits = 64;
+	if(column_indices.size() > num_key_bits)
+		column_indices.resize(num_key_bits);
+
+	std::vector<std::pair<uint64_t, size_t>> keys_and_indices(numEntities);
+	for(size_t entity_index = 0; entity_index < numEntities; entity_index++)
+		keys_and_indices[entity_index] = std::make_pair(0, entity_index);
+
+	size_t num_dimensions = column_indices.size();
+	if(num_dimensions > 0)
+	{
+		size_t bits_per_dimension = std::min<size_t>(num_key_bits / num_dimensions, 32);
+		uint64_t max_quantized_value = (uint64_t(1) << bits_per_dimension) - 1;
+
+		std::vector<uint64_t> quantized_values(numEntities);
+		for(size_t dimension = 0; dimension < num_dimensions; dimension++)
+		{
+			auto &column_data = columnData[column_indices[dimension]];
+
+			//quantize by rank of the value rather than the value itself so that skewed distributions
+			// still spread across the curve; anything without a number is placed at the end
+			std::fill(begin(quantized_values), end(quantized_values), max_quantized_value);
+			auto &value_entries = column_data->sortedNumberValueEntries;
+			double scale = 0.0;
+			if(value_entries.size() > 1)
+				scale = static_cast<double>(max_quantized_value - 1) / (value_entries.size() - 1);
+
+			for(size_t value_index = 0; value_index < value_entries.size(); value_index++)
+			{
+				uint64_t quantized_value = static_cast<uint64_t>(value_index * scale);
+				for(auto entity_index : value_entries[value_index]->indicesWithValue)
+					quantized_values[entity_index] = quantized_value;
+			}
+
+			//interleave the bits of this dimension into the keys
+			for(size_t entity_index = 0; entity_index < numEntities; entity_index++)
+			{
+				uint64_t quantized_value = quantized_values[entity_index];
+				uint64_t &key = keys_and_indices[entity_index].first;
+				for(size_t bit = 0; bit < bits_per_dimension; bit++)
+					key |= ((quantized_value >> bit) & 1) << (bit * num_dimensions + dimension);
+			}
+		}
+	}
+
+	//ties are broken by the current index, so the order is deterministic
+	std::sort(begin(keys_and_indices), end(keys_and_indices));
+
+	std::vector<size_t> entity_order(numEntities);
+	for(size_t i = 0; i < numEntities; i++)
+		entity_order[i] = keys_and_indices[i].second;
+	return entity_order;
+}
+
+void SeparableBoxFilterDataStore::ReorderEntities(const std::vector<Entity *> &entities)
+{
+	std::vector<StringInternPool::StringID> label_sids;
+	label_sids.reserve(columnData.size());
+	for(auto &column_data : columnData)
+		label_sids.push_back(column_data->stringId);
+
+	//clear out everything and rebuild in the new order
+	columnData.clear();
+	labelIdToColumnIndex.clear();
+	MatrixType old_matrix;
+	std::swap(old_matrix, matrix); //swap data pointers to free old memory
+	numEntities = 0;
+
+	AddLabels(label_sids, entities);
+
+#ifdef SBFDS_VERIFICATION
+	VerifyAllEntitiesForAllColumns();
+#endif
+}
+
+void SeparableBoxFilterDataStore::CopyFrom(const SeparableBoxFilterDataStore &other, const std::vector<Entity *> &entities)
+{
+	columnData.clear();
+	columnData.reserve(other.columnData.size());
+	for(auto &column_data : other.columnData)
+		columnData.emplace_back(std::make_unique<SBFDSColumnData>(*column_data));
+
+	labelIdToColumnIndex = other.labelIdToColumnIndex;
+	matrix = other.matrix;
+	numEntities = other.numEntities;
+
+	//code values point to the nodes of the original entities, so point them to the code of the copies instead
+	for(size_t column_index = 0; column_index < columnData.size(); column_index++)
+	{
+		auto &column_data = columnData[column_index];
+		if(column_data->codeIndices.size() == 0)
+			continue;
+
+		bool is_label_accessible = !Entity::IsLabelPrivate(column_data->stringId);
+		for(auto entity_index : column_data->codeIndices)
+		{
+			EvaluableNodeImmediateValue value;
+			entities[entity_index]->GetValueAtLabelAsImmediateValue(column_data->stringId, value, is_label_accessible);
+			GetValue(entity_index, column_index) = value;
+		}
+	}
+
+#ifdef SBFDS_VERIFICATION
+	VerifyAllEntitiesForAllColumns();
+#endif
+}
+
 //populates distances_out with all entities and their distances that have a distance to target less than max_dist
 // and sets distances_out to the found entities.  Infinity is allowed to compute all distances.
 //if enabled_indices is not nullptr, it will only find distances to those entities, and it will modify enabled_indices in-place
@@ -385,7 +606,7 @@ void SeparableBoxFilterDataStore::FindEntitiesWithinDistance(GeneralizedDistance
 	PopulateTargetValuesAndLabelIndices(r_dist_eval, position_label_sids, position_values, position_value_types);
 	
 	bool high_accuracy = dist_eval.highAccuracyDistances;
-	double max_dist_exponentiated = dist_eval.ExponentiateDifferenceTerm(max_dist, high_accuracy);
+	double max_dist_exponentiated = dist_eval.GetCandidateExponentiatedDistanceBound(max_dist, high_accuracy);
 	
 	//initialize all distances to 0
 	auto &distances = parametersAndBuffers.entityDistances;
@@ -410,7 +631,7 @@ void SeparableBoxFilterDataStore::FindEntitiesWithinDistance(GeneralizedDistance
 			if(radius == 0)
 				distances[entity_index] = -max_dist_exponentiated;
 			else
-				distances[entity_index] = -dist_eval.ExponentiateDifferenceTerm(max_dist + radius, high_accuracy);
+				distances[entity_index] = -dist_eval.GetCandidateExponentiatedDistanceBound(max_dist + radius, high_accuracy);
 		}
 
 		max_dist_exponentiated = 0.0;
@@ -524,11 +745,20 @@ void SeparableBoxFilterDataStore::FindEntitiesWithinDistance(GeneralizedDistance
 		for(auto index : enabled_indices)
 			distances_out.emplace_back(dist_eval.InverseExponentiateDistance(distances[index], high_accuracy), index);
 	}
-	else
+	else if(!dist_eval.NeedToRerankAccurateDistances())
 	{
 		for(auto index : enabled_indices)
 			distances_out.emplace_back(GetDistanceBetween(r_dist_eval, radius_column_index, index, true), index);
 	}
+	else //candidates were found with a widened bound, so only keep those actually within max_dist
+	{
+		for(auto index : enabled_indices)
+		{
+			double distance = GetDistanceBetween(r_dist_eval, radius_column_index, index, true);
+			if(distance <= max_dist)
+				distances_out.emplace_back(distance, index);
+		}
+	}
 }
 
 void SeparableBoxFilterDataStore::FindEntitiesNearestToIndexedEntity(GeneralizedDistanceEvaluator &dist_eval,
@@ -599,6 +829,7 @@ void SeparableBoxFilterDataStore::FindEntitiesNearestToIndexedEntity(Generalized
 	//reuse, clear, and set up sorted_results
 	auto &sorted_results = parametersAndBuffers.sortedResults;
 	sorted_results.clear();
+	parametersAndBuffers.rerankCandidates.clear();
 	sorted_results.SetStream(rand_stream);
 	sorted_results.Reserve(top_k);
 
@@ -668,14 +899,21 @@ void SeparableBoxFilterDataStore::FindEntitiesNearestToIndexedEntity(Generalized
 		//already have enough elements, but see if this one is good enough
 		auto [accept, distance] = ResolveDistanceToNonMatchTargetValues(r_dist_eval,
 			partial_sums, entity_index, min_distance_by_unpopulated_count, num_enabled_features,
-			worst_candidate_distance, min_unpopulated_distances, high_accuracy);
+			dist_eval.GetNearestCandidateRejectDistance(worst_candidate_distance), min_unpopulated_distances, high_accuracy);
 
 		if(!accept)
 			continue;
 
+		//if reranking, keep entities that aren't among the nearest but may be after recomputing
+		if(distance > worst_candidate_distance)
+		{
+			parametersAndBuffers.rerankCandidates.emplace_back(distance, entity_index);
+			continue;
+		}
+
 		//if not expanding and pushing a zero distance onto the stack, then push and pop a value onto the stack
 		if(!(expand_to_first_nonzero_distance && distance == 0.0))
-			worst_candidate_distance = sorted_results.PushAndPop(DistanceReferencePair(distance, entity_index)).distance;
+			worst_candidate_distance = PushAndPopNearestCandidate(dist_eval, sorted_results, DistanceReferencePair(distance, entity_index));
 		else //adding a zero and need to expand beyond zeros
 		{
 			//add the zero
@@ -688,9 +926,16 @@ void SeparableBoxFilterDataStore::FindEntitiesNearestToIndexedEntity(Generalized
 			//if the next largest size is zero, then need to put the non-zero value back in sorted_results
 			if(sorted_results.Size() > 0 && sorted_results.Top().distance == 0)
 				sorted_results.Push(drp);
+			else if(dist_eval.NeedToRerankAccurateDistances())
+				parametersAndBuffers.rerankCandidates.push_back(drp);
 		}
 	}
 
+	//the low accuracy distance of the farthest of the nearest entities bounds which rerank candidates are kept
+	double farthest_candidate_distance = std::numeric_limits<double>::infinity();
+	if(sorted_results.Size() > 0)
+		farthest_candidate_distance = sorted_results.Top().distance;
+
 	//return k nearest -- don't need to clear because the values will be clobbered
 	distances_out.resize(sorted_results.Size());
 	//need to recompute distances in several circumstances, including if radius is computed,
@@ -711,6 +956,10 @@ void SeparableBoxFilterDataStore::FindEntitiesNearestToIndexedEntity(Generalized
 		distances_out[sorted_results.Size() - 1] = DistanceReferencePair(distance, drp.reference);
 		sorted_results.Pop();
 	}
+
+	if(dist_eval.NeedToRerankAccurateDistances())
+		AddRerankCandidatesAndKeepNearest(r_dist_eval, radius_column_index, farthest_candidate_distance,
+			top_k, expand_to_first_nonzero_distance, distances_out);
 }
 
 void SeparableBoxFilterDataStore::FindNearestEntities(GeneralizedDistanceEvaluator &dist_eval,
@@ -758,6 +1007,7 @@ void SeparableBoxFilterDataStore::FindNearestEntities(GeneralizedDistanceEvaluat
 	//reuse, clear, and set up sorted_results
 	auto &sorted_results = parametersAndBuffers.sortedResults;
 	sorted_results.clear();
+	parametersAndBuffers.rerankCandidates.clear();
 	sorted_results.SetStream(rand_stream.CreateOtherStreamViaRand());
 	sorted_results.Reserve(top_k);
 
@@ -807,10 +1057,15 @@ void SeparableBoxFilterDataStore::FindNearestEntities(GeneralizedDistanceEvaluat
 
 				auto [accept, distance] = ResolveDistanceToNonMatchTargetValues(r_dist_eval, partial_sums,
 					entity_index, min_distance_by_unpopulated_count, num_enabled_features,
-					worst_candidate_distance, min_unpopulated_distances, high_accuracy);
+					dist_eval.GetNearestCandidateRejectDistance(worst_candidate_distance), min_unpopulated_distances, high_accuracy);
 
-				if(accept)
-					worst_candidate_distance = sorted_results.PushAndPop(DistanceReferencePair(distance, entity_index)).distance;
+				if(!accept)
+					continue;
+
+				if(distance <= worst_candidate_distance)
+					worst_candidate_distance = PushAndPopNearestCandidate(dist_eval, sorted_results, DistanceReferencePair(distance, entity_index));
+				else //only accepted if reranking
+					parametersAndBuffers.rerankCandidates.emplace_back(distance, entity_index);
 			}
 		}
 
@@ -824,7 +1079,7 @@ void SeparableBoxFilterDataStore::FindNearestEntities(GeneralizedDistanceEvaluat
 			if(feature_data.targetValue.IsNull())
 				continue;
 			
-			if(dist_eval.ComputeDistanceTermKnownToUnknown(i, high_accuracy) > worst_candidate_distance)
+			if(dist_eval.ComputeDistanceTermKnownToUnknown(i, high_accuracy) > dist_eval.GetNearestCandidateRejectDistance(worst_candidate_distance))
 			{
 				size_t column_index = dist_eval.featureAttribs[i].featureIndex;
 				auto &column = columnData[column_index];
@@ -856,7 +1111,7 @@ void SeparableBoxFilterDataStore::FindNearestEntities(GeneralizedDistanceEvaluat
 
 				auto [accept, distance] = ResolveDistanceToNonMatchTargetValues(r_dist_eval,
 					partial_sums, entity_index, min_distance_by_unpopulated_count, num_enabled_features,
-					worst_candidate_distance, min_unpopulated_distances, high_accuracy);
+					dist_eval.GetNearestCandidateRejectDistance(worst_candidate_distance), min_unpopulated_distances, high_accuracy);
 
 				if(!accept)
 					continue;
@@ -864,15 +1119,18 @@ void SeparableBoxFilterDataStore::FindNearestEntities(GeneralizedDistanceEvaluat
 			#ifdef _OPENMP
 				#pragma omp critical
 				{
-					//need to check again after going into critical section
+			#endif
+					//need to check again if another thread has updated the worst distance
 					if(distance <= worst_candidate_distance)
 					{
-			#endif
 						//computed the actual distance here, attempt to insert into final sorted results
-						worst_candidate_distance = sorted_results.PushAndPop(DistanceReferencePair<size_t>(distance, entity_index)).distance;
-
-			#ifdef _OPENMP
+						worst_candidate_distance = PushAndPopNearestCandidate(dist_eval, sorted_results, DistanceReferencePair<size_t>(distance, entity_index));
+					}
+					else if(dist_eval.NeedToRerankAccurateDistances())
+					{
+						parametersAndBuffers.rerankCandidates.emplace_back(distance, entity_index);
 					}
+			#ifdef _OPENMP
 				}
 			#endif
 		
@@ -881,6 +1139,11 @@ void SeparableBoxFilterDataStore::FindNearestEntities(GeneralizedDistanceEvaluat
 
 	} // sorted_results.Size() == top_k
 
+	//the low accuracy distance of the farthest of the nearest entities bounds which rerank candidates are kept
+	double farthest_candidate_distance = std::numeric_limits<double>::infinity();
+	if(sorted_results.Size() > 0)
+		farthest_candidate_distance = sorted_results.Top().distance;
+
 	//return and cache k nearest -- don't need to clear because the values will be clobbered
 	size_t num_results = sorted_results.Size();
 	distances_out.resize(num_results);
@@ -906,6 +1169,10 @@ void SeparableBoxFilterDataStore::FindNearestEntities(GeneralizedDistanceEvaluat
 
 		sorted_results.Pop();
 	}
+
+	if(dist_eval.NeedToRerankAccurateDistances())
+		AddRerankCandidatesAndKeepNearest(r_dist_eval, radius_column_index, farthest_candidate_distance,
+			top_k, false, distances_out);
 }
 
 #ifdef SBFDS_VERIFICATION
@@ -1002,7 +1269,7 @@ size_t SeparableBoxFilterDataStore::AddLabelsAsEmptyColumns(std::vector<StringIn
 	}
 
 	//expand the matrix to add the empty columns
-	std::vector<EvaluableNodeImmediateValue> old_matrix;
+	MatrixType old_matrix;
 	std::swap(old_matrix, matrix); //swap data pointers to free old memory
 	matrix.resize(columnData.size() * numEntities);
 
@@ -19,6 +19,7 @@
 #include "IntegerSet.h"
 #include "GeneralizedDistance.h"
 #include "PartialSum.h"
+#include "PlatformSpecific.h"
 #include "SBFDSColumnData.h"
 
 //system headers:
@@ -39,6 +40,8 @@ class Entity;
 class SeparableBoxFilterDataStore
 {
 public:
+	//the matrix is the largest and most randomly accessed buffer, so allow it to use huge pages
+	using MatrixType = std::vector<EvaluableNodeImmediateValue, HugePageAllocator<EvaluableNodeImmediateValue>>;
 
 	//contains the parameters and buffers to perform find operations on the SBFDS
 	// for multithreading, there should be one of these per thread
@@ -62,6 +65,9 @@ public:
 		FlexiblePriorityQueue<CountDistanceReferencePair<size_t>> potentialGoodMatches;
 		StochasticTieBreakingPriorityQueue<DistanceReferencePair<size_t>> sortedResults;
 
+		//entities not among the nearest by low accuracy distance that may be after recomputing with high accuracy
+		std::vector<DistanceReferencePair<size_t>> rerankCandidates;
+
 		//cache of nearest neighbors from previous query
 		std::vector<size_t> previousQueryNearestNeighbors;
 	};
@@ -200,12 +206,33 @@ public:
 	//removes an entity to the database using an incremental update scheme
 	void RemoveEntity(Entity *entity, size_t entity_index, size_t entity_index_to_reassign);
 
+	//like RemoveEntity, but removes all of entity_indices_to_remove in one pass
+	// entity_index_reassignments is a list of pairs, where the entity data at the second index is moved to the first index,
+	// which must be one of the removed indices, such that all remaining entities are indexed below the new number of entities
+	void RemoveEntities(std::vector<size_t> &entity_indices_to_remove,
+		std::vector<std::pair<size_t, size_t>> &entity_index_reassignments);
+
 	//updates all of the label values for entity with index entity_index
 	void UpdateAllEntityLabels(Entity *entity, size_t entity_index);
 
 	//like UpdateAllEntityLabels, but only updates labels for label_updated
 	void UpdateEntityLabel(Entity *entity, size_t entity_index, StringInternPool::StringID label_updated);
 
+	//returns the entity indices ordered along a Z-order (Morton) space-filling curve over the number values
+	// of the columns for label_sids, so that entities near each other in feature space are near each other in index
+	// entities without a number value for a label are placed after all entities with a number value for that label
+	// labels that do not have a column are ignored
+	std::vector<size_t> GetLocalityPreservingEntityOrder(std::vector<StringInternPool::StringID> &label_sids);
+
+	//rebuilds the matrix and all column data such that each entity is indexed by its position in entities
+	// entities must contain the same entities as already in the store, but may be in a different order
+	// building each column in ascending index order leaves the index sets compact
+	void ReorderEntities(const std::vector<Entity *> &entities);
+
+	//sets this store to a copy of other, where entities are copies of the entities indexed by other in the same order
+	// values that are code are updated to reference the code of entities rather than that of the originals
+	void CopyFrom(const SeparableBoxFilterDataStore &other, const std::vector<Entity *> &entities);
+
 	constexpr size_t GetNumInsertedEntities()
 	{
 		return numEntities;
@@ -1017,6 +1044,47 @@ public:
 		std::sort(begin(distances_out), end(distances_out));
 	}
 
+	//pushes drp onto sorted_results and pops the farthest, returning the new farthest distance
+	//if reranking, the popped entity is kept as a rerank candidate
+	inline double PushAndPopNearestCandidate(GeneralizedDistanceEvaluator &dist_eval,
+		StochasticTieBreakingPriorityQueue<DistanceReferencePair<size_t>> &sorted_results, const DistanceReferencePair<size_t> &drp)
+	{
+		if(!dist_eval.NeedToRerankAccurateDistances())
+			return sorted_results.PushAndPop(drp).distance;
+
+		sorted_results.Push(drp);
+		parametersAndBuffers.rerankCandidates.push_back(sorted_results.Top());
+		sorted_results.Pop();
+		return sorted_results.Top().distance;
+	}
+
+	//distances contains the nearest entities by low accuracy distance, recomputed with high accuracy
+	//adds the rerank candidates whose low accuracy distance is within the rerank bound of farthest_candidate_distance,
+	// which is the farthest low accuracy distance of the nearest entities, then sorts distances and keeps only the top_k nearest
+	//if expand_to_first_nonzero_distance, then it will also keep any further zero distances and the first nonzero distance after them
+	inline void AddRerankCandidatesAndKeepNearest(RepeatedGeneralizedDistanceEvaluator &r_dist_eval, size_t radius_column_index,
+		double farthest_candidate_distance, size_t top_k, bool expand_to_first_nonzero_distance,
+		std::vector<DistanceReferencePair<size_t>> &distances)
+	{
+		double max_candidate_distance = r_dist_eval.distEvaluator->GetNearestCandidateRejectDistance(farthest_candidate_distance);
+		for(auto &drp : parametersAndBuffers.rerankCandidates)
+		{
+			if(drp.distance <= max_candidate_distance)
+				distances.emplace_back(GetDistanceBetween(r_dist_eval, radius_column_index, drp.reference, true), drp.reference);
+		}
+
+		std::stable_sort(begin(distances), end(distances));
+
+		size_t num_to_keep = std::min(top_k, distances.size());
+		if(expand_to_first_nonzero_distance)
+		{
+			while(num_to_keep > 0 && num_to_keep < distances.size() && distances[num_to_keep - 1].distance == 0.0)
+				num_to_keep++;
+		}
+
+		distances.resize(num_to_keep);
+	}
+
 	//contains entity lookups for each of the values for each of the columns
 	std::vector<std::unique_ptr<SBFDSColumnData>> columnData;
 	
@@ -1030,7 +1098,7 @@ public:
 	FastHashMap<StringInternPool::StringID, size_t> labelIdToColumnIndex;
 
 	//matrix of cases (rows) * features (columns)
-	std::vector<EvaluableNodeImmediateValue> matrix;
+	MatrixType matrix;
 
 	//the number of entities in the data store; all indices below this value are populated
 	size_t numEntities;
@@ -80,6 +80,11 @@ Entity::Entity(Entity *t)
 		}
 
 		entityRelationships.relationships->container = nullptr;
+
+		//the contained entities were copied in the same order, so copy any query caches rather than rebuilding them
+		EntityQueryCaches *t_caches = t->GetQueryCaches();
+		if(t_caches != nullptr)
+			entityRelationships.relationships->queryCaches = std::make_unique<EntityQueryCaches>(this, *t_caches);
 	}
 	else
 	{
@@ -277,6 +282,10 @@ bool Entity::SetValueAtLabel(StringInternPool::StringID label_sid, EvaluableNode
 	bool dest_prev_value_idempotent = destination->GetIsIdempotent();
 	bool root_rebuilt = false;
 
+	//labels whose values have changed, unless all_labels_changed is set
+	EvaluableNode::LabelsAssocType labels_changed;
+	bool all_labels_changed = false;
+
 	if(!direct_set)
 	{
 		if(new_value == nullptr || new_value->GetNumChildNodes() == 0)
@@ -295,6 +304,9 @@ bool Entity::SetValueAtLabel(StringInternPool::StringID label_sid, EvaluableNode
 			//copy over the existing node, but don't update labels, etc.
 			destination->CopyValueFrom(new_value);
 		}
+
+		for(auto destination_label_sid : destination->GetLabelsStringIds())
+			labels_changed.emplace(destination_label_sid, destination);
 		//the value is being used in the entity, so no longer unique if it was before
 		new_value.unique = false;
 	}
@@ -322,12 +334,22 @@ bool Entity::SetValueAtLabel(StringInternPool::StringID label_sid, EvaluableNode
 
 		//need to replace label in case there are any collapses of labels if multiple labels set
 		EvaluableNode *root = evaluableNodeManager.GetRootNode();
+		bool prev_root_need_cycle_check = (root != nullptr && root->GetNeedCycleCheck());
 
 		EvaluableNodeTreeManipulation::ReplaceLabelInTree(root, label_sid, new_value);
 		evaluableNodeManager.SetRootNode(root);
 
 		if(!batch_call)
-			root_rebuilt = RebuildLabelIndex();
+		{
+			//if no nodes are shared within the tree before or after the replacement, the labels of the replaced
+			// subtree are not used anywhere else, so the index can be updated from only the subtrees that changed
+			if(prev_root_need_cycle_check || root->GetNeedCycleCheck()
+				|| !UpdateLabelIndexForReplacedSubtree(destination, new_value, labels_changed))
+			{
+				root_rebuilt = RebuildLabelIndex();
+				all_labels_changed = true;
+			}
+		}
 	}
 
 	bool dest_new_value_need_cycle_check = (new_value != nullptr && new_value->GetNeedCycleCheck());
@@ -349,7 +371,12 @@ bool Entity::SetValueAtLabel(StringInternPool::StringID label_sid, EvaluableNode
 
 		EntityQueryCaches *container_caches = GetContainerQueryCaches();
 		if(container_caches != nullptr)
-			container_caches->UpdateAllEntityLabels(this, GetEntityIndexOfContainer());
+		{
+			if(all_labels_changed)
+				container_caches->UpdateAllEntityLabels(this, GetEntityIndexOfContainer());
+			else
+				container_caches->UpdateEntityLabels(this, GetEntityIndexOfContainer(), labels_changed);
+		}
 
 		asset_manager.UpdateEntity(this);
 		if(write_listeners != nullptr)
@@ -388,6 +415,11 @@ std::pair<bool, bool> Entity::SetValuesAtLabels(EvaluableNodeReference new_label
 	bool need_node_flags_updated = false;
 	auto &new_label_values_mcn = new_label_values->GetMappedChildNodesReference();
 
+	//direct assignments can add or remove labels, so attempt to update the label index from only the subtrees replaced
+	// when accumulating, the previous value may have been modified in place, so the index will need to be rebuilt
+	bool label_index_needs_rebuild = (direct_set && accum_values);
+	EvaluableNode::LabelsAssocType labels_changed;
+
 	//write changes to write listeners first, as code below may invalidate portions of new_label_values
 	if(write_listeners != nullptr)
 	{
@@ -411,22 +443,52 @@ std::pair<bool, bool> Entity::SetValuesAtLabels(EvaluableNodeReference new_label
 			variable_value_node = AccumulateEvaluableNodeIntoEvaluableNode(value_destination_node, variable_value_node, &evaluableNodeManager);
 		}
 
+		EvaluableNode *prev_value = nullptr;
+		bool prev_root_need_cycle_check = false;
+		if(direct_set && !label_index_needs_rebuild)
+		{
+			auto prev_label = labelIndex.find(variable_sid);
+			if(prev_label != end(labelIndex))
+				prev_value = prev_label->second;
+
+			EvaluableNode *root = evaluableNodeManager.GetRootNode();
+			prev_root_need_cycle_check = (root != nullptr && root->GetNeedCycleCheck());
+		}
+
 		if(SetValueAtLabel(variable_sid, variable_value_node, direct_set, write_listeners, on_self, true, &need_node_flags_updated))
+		{
 			any_successful_assignment = true;
+
+			if(direct_set && !label_index_needs_rebuild)
+			{
+				//the labels of the replaced subtree are only unused elsewhere if no nodes are shared within the tree
+				EvaluableNode *root = evaluableNodeManager.GetRootNode();
+				if(prev_root_need_cycle_check || root == nullptr || root->GetNeedCycleCheck()
+						|| !UpdateLabelIndexForReplacedSubtree(prev_value, labelIndex[variable_sid], labels_changed))
+					label_index_needs_rebuild = true;
+			}
+		}
 		else
+		{
 			all_successful_assignments = false;
+		}
 	}
 
 	if(any_successful_assignment)
 	{
 		EntityQueryCaches *container_caches = GetContainerQueryCaches();
-		if(direct_set)
+		if(direct_set && label_index_needs_rebuild)
 		{
 			//direct assignments need a rebuild of the index just in case a label collision occurs -- will update node flags if needed
 			RebuildLabelIndex();
 			if(container_caches != nullptr)
 				container_caches->UpdateAllEntityLabels(this, GetEntityIndexOfContainer());
 		}
+		else if(direct_set)
+		{
+			if(container_caches != nullptr)
+				container_caches->UpdateEntityLabels(this, GetEntityIndexOfContainer(), labels_changed);
+		}
 		else
 		{
 			if(need_node_flags_updated)
@@ -457,7 +519,7 @@ EvaluableNodeReference Entity::Execute(StringInternPool::StringID label_sid,
 #ifdef MULTITHREAD_SUPPORT
 	, Concurrency::ReadLock *enm_lock
 #endif
-	)
+	, bool immediate_result)
 {
 	if(!on_self && IsLabelPrivate(label_sid))
 		return EvaluableNodeReference(nullptr, true);
@@ -477,23 +539,31 @@ EvaluableNodeReference Entity::Execute(StringInternPool::StringID label_sid,
 	if(node_to_execute == nullptr)
 		return EvaluableNodeReference::Null();
 
-	Interpreter interpreter(&evaluableNodeManager, randomStream.CreateOtherStreamViaRand(),
+	auto interpreter = Interpreter::AcquireInterpreter(&evaluableNodeManager, randomStream.CreateOtherStreamViaRand(),
 		write_listeners, print_listener, performance_constraints, this, calling_interpreter);
 
 #ifdef MULTITHREAD_SUPPORT
 	if(enm_lock == nullptr)
-		interpreter.memoryModificationLock = Concurrency::ReadLock(evaluableNodeManager.memoryModificationMutex);
+		interpreter->memoryModificationLock = Concurrency::ReadLock(evaluableNodeManager.memoryModificationMutex);
 	else
-		interpreter.memoryModificationLock = std::move(*enm_lock);
+		interpreter->memoryModificationLock = std::move(*enm_lock);
 #endif
 
-	EvaluableNodeReference retval = interpreter.ExecuteNode(node_to_execute, call_stack);
+#ifdef MULTITHREAD_SUPPORT
+	EvaluableNodeReference retval = interpreter->ExecuteNode(node_to_execute, call_stack,
+		nullptr, nullptr, nullptr, nullptr, immediate_result);
+#else
+	EvaluableNodeReference retval = interpreter->ExecuteNode(node_to_execute, call_stack,
+		nullptr, nullptr, nullptr, immediate_result);
+#endif
 	
 #ifdef MULTITHREAD_SUPPORT
 	if(enm_lock != nullptr)
-		*enm_lock = std::move(interpreter.memoryModificationLock);
+		*enm_lock = std::move(interpreter->memoryModificationLock);
 #endif
 
+	Interpreter::ReleaseInterpreter(std::move(interpreter));
+
 	return retval;
 }
 
@@ -567,6 +637,52 @@ bool Entity::RebuildLabelIndex()
 	return !collision_free;
 }
 
+bool Entity::UpdateLabelIndexForReplacedSubtree(EvaluableNode *prev_subtree, EvaluableNode *new_subtree,
+	EvaluableNode::LabelsAssocType &labels_changed)
+{
+	auto [prev_labels, prev_collision_free] = EvaluableNodeTreeManipulation::RetrieveLabelIndexesFromTree(prev_subtree);
+	auto [new_labels, new_collision_free] = EvaluableNodeTreeManipulation::RetrieveLabelIndexesFromTree(new_subtree);
+	if(!prev_collision_free || !new_collision_free)
+		return false;
+
+	//if any label introduced by new_subtree is already used elsewhere in the entity, the tree needs to be normalized
+	for(auto &[label_sid, _] : new_labels)
+	{
+		if(prev_labels.find(label_sid) == end(prev_labels) && labelIndex.find(label_sid) != end(labelIndex))
+			return false;
+	}
+
+	//remove labels that were only in the previous subtree
+	for(auto &[label_sid, _] : prev_labels)
+	{
+		if(new_labels.find(label_sid) != end(new_labels))
+			continue;
+
+		auto existing_label = labelIndex.find(label_sid);
+		if(existing_label != end(labelIndex))
+		{
+			labelIndex.erase(existing_label);
+			string_intern_pool.DestroyStringReference(label_sid);
+		}
+
+		labels_changed.emplace(label_sid, nullptr);
+	}
+
+	//add or repoint labels in the new subtree
+	for(auto &[label_sid, node] : new_labels)
+	{
+		auto [existing_label, inserted] = labelIndex.emplace(label_sid, node);
+		if(inserted)
+			string_intern_pool.CreateStringReference(label_sid);
+		else
+			existing_label->second = node;
+
+		labels_changed.emplace(label_sid, node);
+	}
+
+	return true;
+}
+
 StringInternPool::StringID Entity::AddContainedEntity(Entity *t, StringInternPool::StringID id_sid, std::vector<EntityWriteListener *> *write_listeners)
 {
 	if(t == nullptr)
@@ -760,6 +876,125 @@ void Entity::RemoveContainedEntity(StringInternPool::StringID id, std::vector<En
 	}
 }
 
+void Entity::RemoveContainedEntities(std::vector<StringInternPool::StringID> &ids, std::vector<EntityWriteListener *> *write_listeners)
+{
+	if(!hasContainedEntities)
+		return;
+
+	auto &id_to_index_lookup = entityRelationships.relationships->containedEntityStringIdToIndex;
+	auto &contained_entities = entityRelationships.relationships->containedEntities;
+
+	std::vector<size_t> indices_to_remove;
+	indices_to_remove.reserve(ids.size());
+	for(auto id : ids)
+	{
+		const auto &id_to_index_it = id_to_index_lookup.find(id);
+		if(id_to_index_it != end(id_to_index_lookup))
+			indices_to_remove.push_back(id_to_index_it->second);
+	}
+
+	if(indices_to_remove.size() == 0)
+		return;
+
+	std::sort(begin(indices_to_remove), end(indices_to_remove));
+	indices_to_remove.erase(std::unique(begin(indices_to_remove), end(indices_to_remove)), end(indices_to_remove));
+
+	std::vector<Entity *> entities_to_remove;
+	entities_to_remove.reserve(indices_to_remove.size());
+	for(size_t index : indices_to_remove)
+		entities_to_remove.push_back(contained_entities[index]);
+
+	//record the entities as being deleted
+	if(write_listeners != nullptr)
+	{
+		for(auto &wl : *write_listeners)
+			wl->LogDestroyEntities(entities_to_remove);
+
+		for(Entity *entity_to_remove : entities_to_remove)
+			asset_manager.DestroyEntity(entity_to_remove);
+	}
+
+	//fill each removed index below the new number of entities with a remaining entity from the end,
+	// walking the remaining indices above in ascending order and skipping those that are also being removed
+	size_t num_entities = contained_entities.size();
+	size_t new_num_entities = num_entities - indices_to_remove.size();
+	std::vector<std::pair<size_t, size_t>> index_reassignments;
+
+	auto first_removed_above = std::lower_bound(begin(indices_to_remove), end(indices_to_remove), new_num_entities);
+	auto next_removed_above = first_removed_above;
+	size_t index_to_reassign = new_num_entities;
+	for(auto removed = begin(indices_to_remove); removed != first_removed_above; ++removed)
+	{
+		while(next_removed_above != end(indices_to_remove) && *next_removed_above == index_to_reassign)
+		{
+			++next_removed_above;
+			index_to_reassign++;
+		}
+
+		index_reassignments.emplace_back(*removed, index_to_reassign);
+		index_to_reassign++;
+	}
+
+	EntityQueryCaches *caches = GetQueryCaches();
+	if(caches != nullptr)
+		caches->RemoveEntities(indices_to_remove, index_reassignments);
+
+	for(Entity *entity_to_remove : entities_to_remove)
+	{
+		entity_to_remove->SetEntityContainer(nullptr);
+		id_to_index_lookup.erase(entity_to_remove->GetIdStringId());
+	}
+
+	if(new_num_entities > 0)
+	{
+		for(auto [index, index_to_move] : index_reassignments)
+		{
+			id_to_index_lookup[contained_entities[index_to_move]->GetIdStringId()] = index;
+			contained_entities[index] = contained_entities[index_to_move];
+		}
+
+		contained_entities.resize(new_num_entities);
+	}
+	else //removed all entities, clean up
+	{
+		Entity *container = entityRelationships.relationships->container;
+		delete entityRelationships.relationships;
+
+		entityRelationships.container = container;
+		hasContainedEntities = false;
+	}
+}
+
+void Entity::ReorderContainedEntities(std::vector<StringInternPool::StringID> &label_sids)
+{
+	if(!hasContainedEntities)
+		return;
+
+	auto &contained_entities = entityRelationships.relationships->containedEntities;
+	if(contained_entities.size() < 2)
+		return;
+
+	CreateQueryCaches();
+	EntityQueryCaches *caches = GetQueryCaches();
+	std::vector<size_t> entity_order = caches->GetLocalityPreservingEntityOrder(label_sids);
+
+	//if no labels could be used to order the entities, leave them as they are
+	if(entity_order.size() != contained_entities.size())
+		return;
+
+	std::vector<Entity *> reordered_entities(contained_entities.size());
+	auto &id_to_index_lookup = entityRelationships.relationships->containedEntityStringIdToIndex;
+	for(size_t new_index = 0; new_index < entity_order.size(); new_index++)
+	{
+		Entity *e = contained_entities[entity_order[new_index]];
+		reordered_entities[new_index] = e;
+		id_to_index_lookup[e->GetIdStringId()] = new_index;
+	}
+	std::swap(contained_entities, reordered_entities);
+
+	caches->ReorderEntities();
+}
+
 Entity *Entity::GetContainedEntity(StringInternPool::StringID id)
 {
 	if(!hasContainedEntities || id == string_intern_pool.NOT_A_STRING_ID)
@@ -1004,7 +1239,20 @@ void Entity::AccumRoot(EvaluableNodeReference accum_code, bool allocated_with_en
 		}
 
 		if(container_caches != nullptr)
-			container_caches->UpdateAllEntityLabels(this, GetEntityIndexOfContainer());
+		{
+			if(no_label_collisions)
+			{
+				//only the new labels and the labels of the root, which now contains the accumulated code, have changed
+				for(auto root_label_sid : new_root->GetLabelsStringIds())
+					new_labels.emplace(root_label_sid, new_root);
+
+				container_caches->UpdateEntityLabels(this, GetEntityIndexOfContainer(), new_labels);
+			}
+			else
+			{
+				container_caches->UpdateAllEntityLabels(this, GetEntityIndexOfContainer());
+			}
+		}
 	}
 
 	if(write_listeners != nullptr)
@@ -187,6 +187,7 @@ public:
 	// if on_self is true, then it will be allowed to access private variables
 	// if performance_constraints is not nullptr, then it will constrain performance and update performance_constraints
 	// if enm_lock is specified, it should be a lock on this entity's evaluableNodeManager.memoryModificationMutex
+	// if immediate_result is true, then the returned value may be immediate
 	EvaluableNodeReference Execute(StringInternPool::StringID label_sid,
 		EvaluableNode *call_stack, bool on_self = false, Interpreter *calling_interpreter = nullptr,
 		std::vector<EntityWriteListener *> *write_listeners = nullptr, PrintListener *print_listener = nullptr,
@@ -194,7 +195,7 @@ public:
 	#ifdef MULTITHREAD_SUPPORT
 		, Concurrency::ReadLock *enm_lock = nullptr
 	#endif
-		);
+		, bool immediate_result = false);
 
 	//same as Execute but accepts a string for label name
 	inline EvaluableNodeReference Execute(std::string &label_name,
@@ -204,7 +205,7 @@ public:
 	#ifdef MULTITHREAD_SUPPORT
 		, Concurrency::ReadLock *enm_lock = nullptr
 	#endif
-		)
+		, bool immediate_result = false)
 	{
 		StringInternPool::StringID label_sid = string_intern_pool.GetIDFromString(label_name);
 		return Execute(label_sid, call_stack, on_self, calling_interpreter,
@@ -212,7 +213,7 @@ public:
 		#ifdef MULTITHREAD_SUPPORT
 			, enm_lock
 		#endif
-			);
+			, immediate_result);
 	}
 
 	//returns true if the entity or any of its contained entities are currently being executed, either because of multiple threads executing on it
@@ -328,6 +329,13 @@ public:
 	//returns true if there was a change and cycle checks were updated across the entity
 	bool RebuildLabelIndex();
 
+	//updates the label index after prev_subtree has been replaced by new_subtree, using only the labels within those subtrees,
+	// and adds each label whose value changed to labels_changed
+	//assumes neither subtree shares nodes with the rest of the entity's tree
+	//returns false without modifying the index if labels collide, in which case the label index must be rebuilt
+	bool UpdateLabelIndexForReplacedSubtree(EvaluableNode *prev_subtree, EvaluableNode *new_subtree,
+		EvaluableNode::LabelsAssocType &labels_changed);
+
 	//Returns the id for this Entity
 	inline const std::string GetId()
 	{
@@ -358,6 +366,15 @@ public:
 	/// write_listeners is optional, and if specified, will log the event
 	void RemoveContainedEntity(StringInternPool::StringID id, std::vector<EntityWriteListener *> *write_listeners = nullptr);
 
+	//like RemoveContainedEntity, but removes all of the ids at once, repairing the contained entity indices
+	// and query caches in a single pass and logging one write; ids that are not contained are ignored
+	void RemoveContainedEntities(std::vector<StringInternPool::StringID> &ids, std::vector<EntityWriteListener *> *write_listeners = nullptr);
+
+	//reassigns the indices of the contained entities so that entities with similar values for the labels
+	// in label_sids have nearby indices, and reindexes the query caches accordingly
+	// improves the memory locality of queries after many entities have been removed and added
+	void ReorderContainedEntities(std::vector<StringInternPool::StringID> &label_sids);
+
 	//returns the Entity contained by this Entity for the given id, null if it does not exist
 	Entity *GetContainedEntity(StringInternPool::StringID id);
 
@@ -848,7 +865,7 @@ protected:
 	};
 
 	//current list of all labels and where they are in the code
-	EvaluableNode::AssocType labelIndex;
+	EvaluableNode::LabelsAssocType labelIndex;
 
 	//the random stream associated with this Entity
 	RandomStream randomStream;
@@ -3,6 +3,7 @@
 
 #include "AssetManager.h"
 #include "Entity.h"
+#include "EntityQueryCaches.h"
 #include "EntityWriteListener.h"
 #include "FileSupportCAML.h"
 #include "FileSupportJSON.h"
@@ -219,6 +220,98 @@ std::string EntityExternalInterface::ExecuteEntityJSON(std::string &handle, std:
 	return (converted ? result : string_intern_pool.GetStringFromID(string_intern_pool.NOT_A_STRING_ID));
 }
 
+double EntityExternalInterface::ExecuteEntityNumber(std::string &handle, std::string &label,
+	size_t num_args, const char * const *arg_names, const double *arg_values)
+{
+	auto bundle = FindEntityBundle(handle);
+	if(bundle == nullptr)
+		return std::numeric_limits<double>::quiet_NaN();
+
+	EvaluableNodeManager &enm = bundle->entity->evaluableNodeManager;
+#ifdef MULTITHREAD_SUPPORT
+	//lock memory before allocating call stack
+	Concurrency::ReadLock enm_lock(enm.memoryModificationMutex);
+#endif
+
+	EvaluableNodeReference args(enm.AllocNode(ENT_ASSOC), true);
+	args->ReserveMappedChildNodes(num_args);
+	for(size_t i = 0; i < num_args; i++)
+		args->SetMappedChildNode(arg_names[i], enm.AllocNode(arg_values[i]));
+
+	auto call_stack = Interpreter::ConvertArgsToCallStack(args, enm);
+
+	EvaluableNodeReference returned_value = bundle->entity->Execute(label, call_stack, false, nullptr,
+		&bundle->writeListeners, bundle->printListener, nullptr
+#ifdef MULTITHREAD_SUPPORT
+		, &enm_lock
+#endif
+		, true);
+
+	//ConvertArgsToCallStack always adds an outer list that is safe to free
+	enm.FreeNode(call_stack);
+
+	if(returned_value.IsNonNullNodeReference() && returned_value->GetType() == ENT_RETURN)
+		returned_value = RemoveTopConcludeOrReturnNode(returned_value, &enm);
+
+	//only return numbers, so strings and other values, even if they could be converted to a number, are NaN
+	double result = std::numeric_limits<double>::quiet_NaN();
+	auto &value = returned_value.GetValue();
+	if(value.nodeType == ENIVT_NUMBER)
+		result = value.nodeValue.number;
+	else if(value.nodeType == ENIVT_CODE && value.nodeValue.code != nullptr && value.nodeValue.code->GetType() == ENT_NUMBER)
+		result = value.nodeValue.code->GetNumberValueReference();
+
+	enm.FreeNodeTreeIfPossible(returned_value);
+	return result;
+}
+
+bool EntityExternalInterface::CacheContainedEntityLabels(std::string &handle, size_t num_labels, const char * const *label_names)
+{
+	auto bundle = FindEntityBundle(handle);
+	if(bundle == nullptr || bundle->entity == nullptr)
+		return false;
+
+	//labels that are not strings yet cannot be on any entity
+	std::vector<StringInternPool::StringID> label_sids;
+	label_sids.reserve(num_labels);
+	for(size_t i = 0; i < num_labels; i++)
+	{
+		StringInternPool::StringID label_sid = string_intern_pool.GetIDFromString(label_names[i]);
+		if(label_sid != StringInternPool::NOT_A_STRING_ID)
+			label_sids.push_back(label_sid);
+	}
+
+	EntityReadReference entity(bundle->entity);
+	return EntityQueryCaches::CacheContainedEntityLabels(entity, label_sids);
+}
+
+bool EntityExternalInterface::SetEntityGarbageCollectionSoftMemoryLimit(std::string &handle, size_t num_bytes)
+{
+	auto bundle = FindEntityBundle(handle);
+	if(bundle == nullptr || bundle->entity == nullptr)
+		return false;
+
+	bundle->entity->evaluableNodeManager.SetSoftMemoryLimit(num_bytes);
+	return true;
+}
+
+std::string EntityExternalInterface::GetEntityGarbageCollectionMetrics(std::string &handle)
+{
+	auto bundle = FindEntityBundle(handle);
+	if(bundle == nullptr || bundle->entity == nullptr)
+		return "";
+
+	EvaluableNodeManager &enm = bundle->entity->evaluableNodeManager;
+#ifdef MULTITHREAD_SUPPORT
+	Concurrency::ReadLock enm_lock(enm.memoryModificationMutex);
+#endif
+
+	EvaluableNodeReference metrics = enm.GetGarbageCollectionMetricsAsAssoc();
+	auto [result, converted] = EvaluableNodeJSONTranslation::EvaluableNodeToJson(metrics);
+	enm.FreeNodeTree(metrics);
+	return (converted ? result : string_intern_pool.GetStringFromID(string_intern_pool.NOT_A_STRING_ID));
+}
+
 bool EntityExternalInterface::EntityListenerBundle::SetEntityValueAtLabel(std::string &label_name, EvaluableNodeReference new_value)
 {
 	StringInternPool::StringID label_sid = string_intern_pool.GetIDFromString(label_name);
@@ -56,6 +56,24 @@ public:
 	std::string GetJSONFromLabel(std::string &handle, std::string &label);
 	std::string ExecuteEntityJSON(std::string &handle, std::string &label, std::string_view json);
 
+	//executes label on handle with the arguments named by arg_names having the respective values in arg_values,
+	// both of length num_args, and returns the result as a number, or NaN if it is not a number,
+	// including strings that contain numbers
+	//avoids all JSON parsing and formatting and allows the result to be returned as an immediate value
+	double ExecuteEntityNumber(std::string &handle, std::string &label,
+		size_t num_args, const char * const *arg_names, const double *arg_values);
+
+	//builds the query caches of the entities contained by handle for the num_labels labels in label_names,
+	// returns false if the entity does not exist or query caches are disabled
+	//takes only read locks, so it may be called from a separate thread to warm the caches while the entity is being used
+	bool CacheContainedEntityLabels(std::string &handle, size_t num_labels, const char * const *label_names);
+
+	//sets the soft memory limit in bytes for the nodes of handle, returns false if the entity does not exist
+	bool SetEntityGarbageCollectionSoftMemoryLimit(std::string &handle, size_t num_bytes);
+
+	//returns the garbage collection metrics of handle as json
+	std::string GetEntityGarbageCollectionMetrics(std::string &handle);
+
 protected:
 
 	//a class that manages the entity
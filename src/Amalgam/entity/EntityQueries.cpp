@@ -6,6 +6,7 @@
 #include "EvaluableNodeTreeFunctions.h"
 
 bool _enable_SBF_datastore = true;
+bool _enable_query_result_cache = false;
 
 bool EntityQueryCondition::DoesEntityMatchCondition(Entity *e)
 {
@@ -701,7 +702,9 @@ EvaluableNodeReference EntityQueryCondition::GetMatchingEntities(Entity *contain
 		StochasticTieBreakingPriorityQueue<DistanceReferencePair<Entity *>> nearest_entities(randomStream.CreateOtherStreamViaRand());
 		for(size_t i = 0; i < matching_entities.size(); i++)
 		{
-			double value = GetConditionDistanceMeasure(matching_entities[i], distEvaluator.highAccuracyDistances);
+			//if reranking, every distance is computed anyway, so compute it with high accuracy
+			double value = GetConditionDistanceMeasure(matching_entities[i],
+				distEvaluator.highAccuracyDistances || distEvaluator.NeedToRerankAccurateDistances());
 			if(FastIsNaN(value))
 				continue;
 
@@ -730,7 +733,8 @@ EvaluableNodeReference EntityQueryCondition::GetMatchingEntities(Entity *contain
 		if(enm == nullptr)
 			return EvaluableNodeReference::Null();
 
-		if(!distEvaluator.highAccuracyDistances && distEvaluator.recomputeAccurateDistances)
+		if(!distEvaluator.highAccuracyDistances && distEvaluator.recomputeAccurateDistances
+			&& !distEvaluator.NeedToRerankAccurateDistances())
 		{
 			//recompute distance accurately for each found entity result
 			for(auto &it : entity_values)
@@ -20,6 +20,9 @@ class Entity;
 //if set to false, will not allow use of the SBF datastore
 extern bool _enable_SBF_datastore;
 
+//if set to true, will reuse the results of identical queries between writes to the queried entity
+extern bool _enable_query_result_cache;
+
 class EntityQueryCondition
 {
 public:
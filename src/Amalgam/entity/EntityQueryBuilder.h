@@ -483,6 +483,7 @@ namespace EntityQueryBuilder
 		//set numerical precision
 		cur_condition->distEvaluator.highAccuracyDistances = false;
 		cur_condition->distEvaluator.recomputeAccurateDistances = true;
+		cur_condition->distEvaluator.rerankAccurateDistances = false;
 		if(ocn.size() > NUMERICAL_PRECISION)
 		{
 			StringInternPool::StringID np_sid = EvaluableNode::ToStringIDIfExists(ocn[NUMERICAL_PRECISION]);
@@ -496,6 +497,10 @@ namespace EntityQueryBuilder
 				cur_condition->distEvaluator.highAccuracyDistances = false;
 				cur_condition->distEvaluator.recomputeAccurateDistances = false;
 			}
+			else if(np_sid == GetStringIdFromBuiltInStringId(ENBISI_rerank_precise))
+			{
+				cur_condition->distEvaluator.rerankAccurateDistances = true;
+			}
 			//don't need to do anything for np_sid == ENBISI_recompute_precise because it's default
 		}
 		
@@ -8,6 +8,7 @@
 #include "HashMaps.h"
 #include "IntegerSet.h"
 #include "KnnCache.h"
+#include "Parser.h"
 #include "SeparableBoxFilterDataStore.h"
 #include "StringInternPool.h"
 #include "WeightedDiscreteRandomStream.h"
@@ -18,6 +19,93 @@ thread_local
 #endif
 EntityQueryCaches::QueryCachesBuffers EntityQueryCaches::buffers;
 
+size_t _knn_cache_memory_budget = 1ULL << 30;
+
+EntityQueryCaches::EntityQueryCaches(Entity *_container, EntityQueryCaches &other)
+	: container(_container), writeVersion(0), queryResultCacheWriteVersion(0)
+{
+#if defined(MULTITHREAD_SUPPORT) || defined(MULTITHREAD_INTERFACE)
+	Concurrency::ReadLock read_lock(other.mutex);
+#endif
+
+	sbfds.CopyFrom(other.sbfds, container->GetContainedEntities());
+}
+
+std::vector<size_t> EntityQueryCaches::GetLocalityPreservingEntityOrder(std::vector<StringInternPool::StringID> &label_sids)
+{
+#if defined(MULTITHREAD_SUPPORT) || defined(MULTITHREAD_INTERFACE)
+	Concurrency::WriteLock write_lock(mutex);
+#endif
+
+	sbfds.AddLabels(label_sids, container->GetContainedEntities());
+	return sbfds.GetLocalityPreservingEntityOrder(label_sids);
+}
+
+void EntityQueryCaches::ReorderEntities()
+{
+#if defined(MULTITHREAD_SUPPORT) || defined(MULTITHREAD_INTERFACE)
+	Concurrency::WriteLock write_lock(mutex);
+#endif
+
+	writeVersion++;
+	sbfds.ReorderEntities(container->GetContainedEntities());
+}
+
+std::string EntityQueryCaches::GetQueryResultCacheKey(EvaluableNode *query_params, std::vector<EntityQueryCondition> &conditions, EvaluableNodeManager *enm, bool return_query_value)
+{
+	std::string key = Parser::Unparse(query_params, enm, false, false, true);
+	key.push_back(return_query_value ? '1' : '0');
+
+	for(auto &cond : conditions)
+	{
+		if(cond.hasRandomStream)
+			key.append(cond.randomStream.GetState());
+	}
+
+	return key;
+}
+
+EvaluableNodeReference EntityQueryCaches::GetCachedQueryResult(const std::string &query_key, size_t write_version, EvaluableNodeManager *enm)
+{
+#if defined(MULTITHREAD_SUPPORT) || defined(MULTITHREAD_INTERFACE)
+	Concurrency::SingleLock lock(queryResultCacheMutex);
+#endif
+
+	if(queryResultCacheWriteVersion != write_version)
+		return EvaluableNodeReference::Null();
+
+	auto found = queryResultCache.find(query_key);
+	if(found == end(queryResultCache))
+		return EvaluableNodeReference::Null();
+
+	return enm->DeepAllocCopy(found->second);
+}
+
+void EntityQueryCaches::CacheQueryResult(const std::string &query_key, size_t write_version, EvaluableNode *result)
+{
+	if(result == nullptr)
+		return;
+
+#if defined(MULTITHREAD_SUPPORT) || defined(MULTITHREAD_INTERFACE)
+	Concurrency::SingleLock lock(queryResultCacheMutex);
+#endif
+
+	//if a write occurred while the query was running, the result may be stale
+	if(writeVersion != write_version)
+		return;
+
+	//discard any results computed before the most recent write
+	if(queryResultCacheWriteVersion != write_version || queryResultCache.size() >= maxNumCachedQueryResults)
+	{
+		ClearQueryResultCache();
+		queryResultCacheWriteVersion = write_version;
+	}
+
+	auto [entry, inserted] = queryResultCache.emplace(query_key, nullptr);
+	if(inserted)
+		entry->second = queryResultCacheNodes.DeepAllocCopy(result);
+}
+
 bool EntityQueryCaches::DoesCachedConditionMatch(EntityQueryCondition *cond, bool last_condition)
 {
 	EvaluableNodeType qt = cond->queryType;
@@ -48,16 +136,8 @@ static bool CanUseQueryCaches(std::vector<EntityQueryCondition> &conditions)
 	return true;
 }
 
-#if defined(MULTITHREAD_SUPPORT) || defined(MULTITHREAD_INTERFACE)
-void EntityQueryCaches::EnsureLabelsAreCached(EntityQueryCondition *cond, Concurrency::ReadLock &lock)
-#else
-void EntityQueryCaches::EnsureLabelsAreCached(EntityQueryCondition *cond)
-#endif
+void EntityQueryCaches::AppendLabelsNotCached(EntityQueryCondition *cond, std::vector<StringInternPool::StringID> &labels_to_add)
 {
-	//if there are any labels that need to be added,
-	// this will collected them to be added all at once
-	std::vector<StringInternPool::StringID> labels_to_add;
-
 	//add label to cache if missing
 	switch(cond->queryType)
 	{
@@ -159,8 +239,58 @@ void EntityQueryCaches::EnsureLabelsAreCached(EntityQueryCondition *cond)
 			}
 		}
 	}
+}
+
+#if defined(MULTITHREAD_SUPPORT) || defined(MULTITHREAD_INTERFACE)
+void EntityQueryCaches::EnsureLabelsAreCached(EntityQueryCondition *cond, Concurrency::ReadLock &lock)
+#else
+void EntityQueryCaches::EnsureLabelsAreCached(EntityQueryCondition *cond)
+#endif
+{
+	std::vector<StringInternPool::StringID> labels_to_add;
+	AppendLabelsNotCached(cond, labels_to_add);
+
+#if defined(MULTITHREAD_SUPPORT) || defined(MULTITHREAD_INTERFACE)
+	AddLabelsNotCached(labels_to_add, lock);
+#else
+	AddLabelsNotCached(labels_to_add);
+#endif
+}
+
+void EntityQueryCaches::CacheLabelsIncrementally(std::vector<StringInternPool::StringID> &label_sids)
+{
+#if defined(MULTITHREAD_SUPPORT) || defined(MULTITHREAD_INTERFACE)
+	for(auto label_sid : label_sids)
+	{
+		if(label_sid == StringInternPool::NOT_A_STRING_ID)
+			continue;
+
+		Concurrency::WriteLock write_lock(mutex);
+		if(DoesHaveLabel(label_sid))
+			continue;
+
+		std::vector<StringInternPool::StringID> label_to_add{ label_sid };
+		sbfds.AddLabels(label_to_add, container->GetContainedEntities());
+	}
+#else
+	std::vector<StringInternPool::StringID> labels_to_add;
+	for(auto label_sid : label_sids)
+	{
+		if(label_sid != StringInternPool::NOT_A_STRING_ID && !DoesHaveLabel(label_sid)
+				&& std::find(begin(labels_to_add), end(labels_to_add), label_sid) == end(labels_to_add))
+			labels_to_add.push_back(label_sid);
+	}
 
+	AddLabelsNotCached(labels_to_add);
+#endif
+}
 
+#if defined(MULTITHREAD_SUPPORT) || defined(MULTITHREAD_INTERFACE)
+void EntityQueryCaches::AddLabelsNotCached(std::vector<StringInternPool::StringID> &labels_to_add, Concurrency::ReadLock &lock)
+#else
+void EntityQueryCaches::AddLabelsNotCached(std::vector<StringInternPool::StringID> &labels_to_add)
+#endif
+{
 	if(labels_to_add.size() == 0)
 		return;
 
@@ -1300,26 +1430,57 @@ EvaluableNodeReference EntityQueryCaches::GetMatchingEntitiesFromQueryCaches(Ent
 }
 
 
-EvaluableNodeReference EntityQueryCaches::GetEntitiesMatchingQuery(EntityReadReference &container, std::vector<EntityQueryCondition> &conditions, EvaluableNodeManager *enm, bool return_query_value)
+void EntityQueryCaches::EnsureQueryCachesExist(EntityReadReference &container)
+{
+	//if haven't built a cache before, need to build the cache container
+	//need to lock the entity to prevent multiple caches from being built concurrently and overwritten
+	if(container->HasQueryCaches())
+		return;
+
+#ifdef MULTITHREAD_SUPPORT
+	container.lock.unlock();
+	EntityWriteReference write_lock(container);
+	if(!container->HasQueryCaches())
+		container->CreateQueryCaches();
+	write_lock.lock.unlock();
+	container.lock.lock();
+#else
+	container->CreateQueryCaches();
+#endif
+}
+
+bool EntityQueryCaches::CacheContainedEntityLabels(EntityReadReference &container, std::vector<StringInternPool::StringID> &label_sids)
+{
+	if(!_enable_SBF_datastore)
+		return false;
+
+	EnsureQueryCachesExist(container);
+	container->GetQueryCaches()->CacheLabelsIncrementally(label_sids);
+	return true;
+}
+
+EvaluableNodeReference EntityQueryCaches::GetEntitiesMatchingQuery(EntityReadReference &container, std::vector<EntityQueryCondition> &conditions, EvaluableNodeManager *enm, bool return_query_value,
+	EvaluableNode *query_params)
 {
 	if(_enable_SBF_datastore && CanUseQueryCaches(conditions))
 	{
-		//if haven't built a cache before, need to build the cache container
-		//need to lock the entity to prevent multiple caches from being built concurrently and overwritten
-		if(!container->HasQueryCaches())
-		{
-		#ifdef MULTITHREAD_SUPPORT
-			container.lock.unlock();
-			EntityWriteReference write_lock(container);
-			container->CreateQueryCaches();
-			write_lock.lock.unlock();
-			container.lock.lock();
-		#else
-			container->CreateQueryCaches();
-		#endif
-		}
+		EnsureQueryCachesExist(container);
+
+		if(!_enable_query_result_cache || query_params == nullptr)
+			return GetMatchingEntitiesFromQueryCaches(container, conditions, enm, return_query_value);
+
+		//compute the key before running the query, as the query advances the random streams of the conditions
+		EntityQueryCaches *entity_caches = container->GetQueryCaches();
+		size_t write_version = entity_caches->writeVersion;
+		std::string query_key = GetQueryResultCacheKey(query_params, conditions, enm, return_query_value);
+
+		EvaluableNodeReference cached_result = entity_caches->GetCachedQueryResult(query_key, write_version, enm);
+		if(cached_result != nullptr)
+			return cached_result;
 
-		return GetMatchingEntitiesFromQueryCaches(container, conditions, enm, return_query_value);
+		EvaluableNodeReference result = GetMatchingEntitiesFromQueryCaches(container, conditions, enm, return_query_value);
+		entity_caches->CacheQueryResult(query_key, write_version, result);
+		return result;
 	}
 
 	if(container == nullptr)
@@ -1345,21 +1506,7 @@ EvaluableNodeReference EntityQueryCaches::GetEntitiesMatchingQuery(EntityReadRef
 			if(!CanUseQueryCaches(conditions))
 				return EvaluableNodeReference::Null();
 
-			//if haven't built a cache before, need to build the cache container
-			//need to lock the entity to prevent multiple caches from being built concurrently and overwritten
-			if(!container->HasQueryCaches())
-			{
-			#ifdef MULTITHREAD_SUPPORT
-				container.lock.unlock();
-				EntityWriteReference write_lock(container);
-				container->CreateQueryCaches();
-				write_lock.lock.unlock();
-				container.lock.lock();
-			#else
-				container->CreateQueryCaches();
-			#endif
-			}
-
+			EnsureQueryCachesExist(container);
 			return GetMatchingEntitiesFromQueryCaches(container, conditions, enm, return_query_value);	
 		}
 
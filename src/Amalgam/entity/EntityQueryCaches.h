@@ -11,7 +11,9 @@
 
 //system headers:
 #include <algorithm>
+#include <atomic>
 #include <memory>
+#include <string>
 #include <vector>
 
 //forward declarations:
@@ -24,9 +26,13 @@ class EntityQueryCaches
 {
 public:
 
-	EntityQueryCaches(Entity *_container) : container(_container)
+	EntityQueryCaches(Entity *_container) : container(_container), writeVersion(0), queryResultCacheWriteVersion(0)
 	{	}
 
+	//constructs a copy of other for _container, where _container contains copies of the entities
+	// contained by other's container in the same order
+	EntityQueryCaches(Entity *_container, EntityQueryCaches &other);
+
 	//adds the entity to the cache
 	// container should contain entity
 	// entity_index is the index that the entity should be stored as
@@ -39,6 +45,7 @@ public:
 			write_lock.lock();
 	#endif
 
+		writeVersion++;
 		sbfds.AddEntity(e, entity_index);
 	}
 
@@ -54,9 +61,23 @@ public:
 			write_lock.lock();
 	#endif
 
+		writeVersion++;
 		sbfds.RemoveEntity(e, entity_index, entity_index_to_reassign);
 	}
 
+	//like RemoveEntity, but removes all entities at entity_indices_to_remove at once, moving the entity data
+	// from the second index to the first index of each pair in entity_index_reassignments
+	inline void RemoveEntities(std::vector<size_t> &entity_indices_to_remove,
+		std::vector<std::pair<size_t, size_t>> &entity_index_reassignments)
+	{
+	#if defined(MULTITHREAD_SUPPORT) || defined(MULTITHREAD_INTERFACE)
+		Concurrency::WriteLock write_lock(mutex);
+	#endif
+
+		writeVersion++;
+		sbfds.RemoveEntities(entity_indices_to_remove, entity_index_reassignments);
+	}
+
 	//updates all of the label values for entity e with index entity_index
 	inline void UpdateAllEntityLabels(Entity *entity, size_t entity_index)
 	{
@@ -64,16 +85,20 @@ public:
 		Concurrency::WriteLock write_lock(mutex);
 	#endif
 
+		writeVersion++;
 		sbfds.UpdateAllEntityLabels(entity, entity_index);
 	}
 
 	//like UpdateAllEntityLabels, but only updates labels for the keys of labels_updated
-	inline void UpdateEntityLabels(Entity *entity, size_t entity_index, EvaluableNode::AssocType &labels_updated)
+	//LabelsMapType may be any map keyed by label StringID
+	template<typename LabelsMapType>
+	inline void UpdateEntityLabels(Entity *entity, size_t entity_index, LabelsMapType &labels_updated)
 	{
 	#if defined(MULTITHREAD_SUPPORT) || defined(MULTITHREAD_INTERFACE)
 		Concurrency::WriteLock write_lock(mutex);
 	#endif
 
+		writeVersion++;
 		for(auto &[label_id, _] : labels_updated)
 			sbfds.UpdateEntityLabel(entity, entity_index, label_id);
 	}
@@ -85,9 +110,17 @@ public:
 		Concurrency::WriteLock write_lock(mutex);
 	#endif
 
+		writeVersion++;
 		sbfds.UpdateEntityLabel(entity, entity_index, label_updated);
 	}
 
+	//returns the entity indices ordered such that entities near each other in the feature space of label_sids
+	// are near each other, building any labels that are not yet cached
+	std::vector<size_t> GetLocalityPreservingEntityOrder(std::vector<StringInternPool::StringID> &label_sids);
+
+	//reindexes all caches to match the current order of the container's contained entities
+	void ReorderEntities();
+
 	//specifies that this cache can be used for the input condition
 	static bool DoesCachedConditionMatch(EntityQueryCondition *cond, bool last_condition);
 
@@ -97,6 +130,17 @@ public:
 		return sbfds.DoesHaveLabel(label_id);
 	}
 
+	//appends any labels needed for cond that are not in the cache to labels_to_add
+	void AppendLabelsNotCached(EntityQueryCondition *cond, std::vector<StringInternPool::StringID> &labels_to_add);
+
+	//adds all of labels_to_add that are not yet in the cache
+	// in multithreaded builds, lock is a read lock on mutex that is temporarily released to build the labels
+#if defined(MULTITHREAD_SUPPORT) || defined(MULTITHREAD_INTERFACE)
+	void AddLabelsNotCached(std::vector<StringInternPool::StringID> &labels_to_add, Concurrency::ReadLock &lock);
+#else
+	void AddLabelsNotCached(std::vector<StringInternPool::StringID> &labels_to_add);
+#endif
+
 	//makes sure any labels needed for cond are in the cache
 #if defined(MULTITHREAD_SUPPORT) || defined(MULTITHREAD_INTERFACE)
 	void EnsureLabelsAreCached(EntityQueryCondition *cond, Concurrency::ReadLock &lock);
@@ -104,6 +148,11 @@ public:
 	void EnsureLabelsAreCached(EntityQueryCondition *cond);
 #endif
 
+	//adds each of label_sids that is not yet in the cache
+	// in multithreaded builds, the labels are built one at a time, each under its own write lock,
+	// so that concurrent queries only wait on the label currently being built
+	void CacheLabelsIncrementally(std::vector<StringInternPool::StringID> &label_sids);
+
 	//returns the set matching_entities of entity ids in the cache that match the provided query condition cond, will fill compute_results with numeric results if KNN query
 	//if is_first is true, optimizes to skip unioning results with matching_entities (just overwrites instead).
 	void GetMatchingEntities(EntityQueryCondition *cond, BitArrayIntegerSet &matching_entities, std::vector<DistanceReferencePair<size_t>> &compute_results, bool is_first, bool update_matching_entities);
@@ -124,15 +173,40 @@ public:
 	//searches container for contained entities matching query.
 	// if return_query_value is false, then returns a list of all IDs of matching contained entities
 	// if return_query_value is true, then returns whatever the appropriate structure is for the query type for the final query
-	static EvaluableNodeReference GetEntitiesMatchingQuery(EntityReadReference &container, std::vector<EntityQueryCondition> &conditions, EvaluableNodeManager *enm, bool return_query_value);
+	// if query_params is not null and the query result cache is enabled, query_params is used to look up and store
+	// the result so that an identical query between writes returns a copy of the prior result
+	static EvaluableNodeReference GetEntitiesMatchingQuery(EntityReadReference &container, std::vector<EntityQueryCondition> &conditions, EvaluableNodeManager *enm, bool return_query_value,
+		EvaluableNode *query_params = nullptr);
+
+	//creates the query caches for container if it does not have them yet
+	// in multithreaded builds, temporarily upgrades the read reference to a write reference to create them
+	static void EnsureQueryCachesExist(EntityReadReference &container);
+
+	//builds the query caches of container for each of label_sids ahead of any query that needs them
+	// returns false if the query caches are disabled
+	static bool CacheContainedEntityLabels(EntityReadReference &container, std::vector<StringInternPool::StringID> &label_sids);
 
 	//returns the collection of entities (and optionally associated compute values) that satisfy the specified chain of query conditions
 	// uses efficient querying methods with a query database, one database per container
 	static EvaluableNodeReference GetMatchingEntitiesFromQueryCaches(Entity *container, std::vector<EntityQueryCondition> &conditions, EvaluableNodeManager *enm, bool return_query_value);
 
+	//returns the key for the query result cache that uniquely identifies the query specified by query_params,
+	// conditions, and return_query_value, including the state of any random streams used by the conditions
+	static std::string GetQueryResultCacheKey(EvaluableNode *query_params, std::vector<EntityQueryCondition> &conditions, EvaluableNodeManager *enm, bool return_query_value);
+
+	//returns a copy of the result for query_key allocated from enm if it was cached at write_version,
+	// otherwise returns null
+	EvaluableNodeReference GetCachedQueryResult(const std::string &query_key, size_t write_version, EvaluableNodeManager *enm);
+
+	//stores a copy of result for query_key if no writes have occurred since write_version
+	void CacheQueryResult(const std::string &query_key, size_t write_version, EvaluableNode *result);
+
 	//the container this is a cache for
 	Entity *container;
 
+	//incremented every time an entity is added, removed, or has its labels updated
+	std::atomic<size_t> writeVersion;
+
 	SeparableBoxFilterDataStore sbfds;
 
 	//buffers to be reused for less memory churn
@@ -177,4 +251,31 @@ public:
 #endif
 		//buffers that can be used for less memory churn (per-thread if multithreaded)
 		static QueryCachesBuffers buffers;
+
+protected:
+
+	//frees all cached query results
+	//assumes queryResultCacheMutex is locked if multithreaded
+	inline void ClearQueryResultCache()
+	{
+		queryResultCache.clear();
+		queryResultCacheNodes.FreeAllNodes();
+	}
+
+	//maximum number of query results to keep before the cache is cleared
+	static constexpr size_t maxNumCachedQueryResults = 256;
+
+	//writeVersion at the time the results in queryResultCache were computed
+	size_t queryResultCacheWriteVersion;
+
+	//query results keyed by GetQueryResultCacheKey
+	FastHashMap<std::string, EvaluableNode *> queryResultCache;
+
+	//storage for the nodes of the cached query results
+	EvaluableNodeManager queryResultCacheNodes;
+
+#if defined(MULTITHREAD_SUPPORT) || defined(MULTITHREAD_INTERFACE)
+	//mutex for queryResultCache and queryResultCacheNodes
+	Concurrency::SingleMutex queryResultCacheMutex;
+#endif
 };
@@ -127,6 +127,20 @@ void EntityWriteListener::LogDestroyEntity(Entity *destroyed_entity)
 	LogNewEntry(new_destroy);
 }
 
+void EntityWriteListener::LogDestroyEntities(std::vector<Entity *> &destroyed_entities)
+{
+#ifdef MULTITHREAD_SUPPORT
+	Concurrency::SingleLock lock(mutex);
+#endif
+
+	EvaluableNode *new_destroy = listenerStorage.AllocNode(ENT_DESTROY_ENTITIES);
+	new_destroy->ReserveOrderedChildNodes(destroyed_entities.size());
+	for(Entity *destroyed_entity : destroyed_entities)
+		new_destroy->AppendOrderedChildNode(GetTraversalIDPathFromAToB(&listenerStorage, listeningEntity, destroyed_entity));
+
+	LogNewEntry(new_destroy);
+}
+
 void EntityWriteListener::LogSetEntityRandomSeed(Entity *entity, const std::string &rand_seed, bool deep_set)
 {
 #ifdef MULTITHREAD_SUPPORT
@@ -36,6 +36,9 @@ public:
 
 	void LogDestroyEntity(Entity *destroyed_entity);
 
+	//like LogDestroyEntity, but logs the destruction of all destroyed_entities as one write
+	void LogDestroyEntities(std::vector<Entity *> &destroyed_entities);
+
 	void LogSetEntityRandomSeed(Entity *entity, const std::string &rand_seed, bool deep_set);
 
 	void FlushLogFile();
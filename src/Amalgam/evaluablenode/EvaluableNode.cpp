@@ -256,6 +256,13 @@ StringInternPool::StringID EvaluableNode::ToStringIDIfExists(EvaluableNode *e)
 	if((e->GetType() == ENT_STRING || e->GetType() == ENT_SYMBOL))
 		return e->GetStringIDReference();
 
+	if(e->GetType() == ENT_NUMBER)
+	{
+		StringInternPool::StringID cached_sid = string_intern_pool.GetCachedIntegerStringID(e->GetNumberValueReference());
+		if(cached_sid != StringInternPool::NOT_A_STRING_ID)
+			return cached_sid;
+	}
+
 	//see if the string exists even if it is not stored as a StringID
 	const std::string str_value = ToStringPreservingOpcodeType(e);
 	//will return empty string if not found
@@ -270,6 +277,13 @@ StringInternPool::StringID EvaluableNode::ToStringIDWithReference(EvaluableNode
 	if(e->GetType() == ENT_STRING || e->GetType() == ENT_SYMBOL)
 		return string_intern_pool.CreateStringReference(e->GetStringIDReference());
 
+	if(e->GetType() == ENT_NUMBER)
+	{
+		StringInternPool::StringID cached_sid = string_intern_pool.GetCachedIntegerStringID(e->GetNumberValueReference());
+		if(cached_sid != StringInternPool::NOT_A_STRING_ID)
+			return string_intern_pool.CreateStringReference(cached_sid);
+	}
+
 	std::string stringified = ToStringPreservingOpcodeType(e);
 	return string_intern_pool.CreateStringReference(stringified);
 }
@@ -289,6 +303,13 @@ StringInternPool::StringID EvaluableNode::ToStringIDTakingReferenceAndClearing(E
 		return sid_to_return;
 	}
 
+	if(e->GetType() == ENT_NUMBER)
+	{
+		StringInternPool::StringID cached_sid = string_intern_pool.GetCachedIntegerStringID(e->GetNumberValueReference());
+		if(cached_sid != StringInternPool::NOT_A_STRING_ID)
+			return string_intern_pool.CreateStringReference(cached_sid);
+	}
+
 	std::string stringified = ToStringPreservingOpcodeType(e);
 	return string_intern_pool.CreateStringReference(stringified);
 }
@@ -309,7 +330,13 @@ void EvaluableNode::ConvertOrderedListToNumberedAssoc()
 	auto &ocn = GetOrderedChildNodes();
 	new_map.reserve(ocn.size());
 	for(size_t i = 0; i < ocn.size(); i++)
-		new_map[string_intern_pool.CreateStringReference(NumberToString(i))] = ocn[i];
+	{
+		StringInternPool::StringID cached_sid = string_intern_pool.GetCachedIntegerStringID(static_cast<double>(i));
+		if(cached_sid != StringInternPool::NOT_A_STRING_ID)
+			new_map[string_intern_pool.CreateStringReference(cached_sid)] = ocn[i];
+		else
+			new_map[string_intern_pool.CreateStringReference(NumberToString(i))] = ocn[i];
+	}
 
 	InitMappedChildNodes();
 	type = ENT_ASSOC;
@@ -1739,6 +1766,34 @@ bool EvaluableNode::AreDeepEqualGivenShallowEqual(EvaluableNode *a, EvaluableNod
 	return true;
 }
 
+bool EvaluableNode::IsNodeTreeFreeOfMetadata(EvaluableNode *n)
+{
+	if(n == nullptr)
+		return true;
+
+	if(n->HasMetadata())
+		return false;
+
+	if(n->IsAssociativeArray())
+	{
+		for(auto &[_, e] : n->GetMappedChildNodesReference())
+		{
+			if(!IsNodeTreeFreeOfMetadata(e))
+				return false;
+		}
+	}
+	else if(!n->IsImmediate())
+	{
+		for(auto &e : n->GetOrderedChildNodesReference())
+		{
+			if(!IsNodeTreeFreeOfMetadata(e))
+				return false;
+		}
+	}
+
+	return true;
+}
+
 bool EvaluableNode::CanNodeTreeBeFlattenedRecurse(EvaluableNode *n, std::vector<EvaluableNode *> &stack)
 {
 	//do a linear find because the logarithmic size of depth should be small enough to make this faster
@@ -47,7 +47,8 @@ public:
 	using KeywordLookupType = FastHashMap<std::string, EvaluableNodeType>;
 
 	//EvaluableNode assoc storage
-	using AssocType = CompactHashMap<StringInternPool::StringID, EvaluableNode *>;
+	// most assocs are small records, so entries are kept flat and only indexed by a hash table when larger
+	using AssocType = FlatHybridHashMap<StringInternPool::StringID, EvaluableNode *>;
 
 	//Storage for labels
 	using LabelsAssocType = CompactHashMap<StringInternPool::StringID, EvaluableNode *>;
@@ -185,6 +186,16 @@ public:
 		SetConcurrency(false);
 	}
 
+	//returns true if the node has any metadata
+	__forceinline bool HasMetadata()
+	{
+		return (GetNumLabels() > 0 || HasComments() || GetConcurrency());
+	}
+
+	//returns true if neither n nor any node it contains has metadata
+	//assumes the tree does not need a cycle check
+	static bool IsNodeTreeFreeOfMetadata(EvaluableNode *n);
+
 	//Evaluates the fraction of the labels of nodes that are the same, 1.0 if no labels on either
 	//num_common_labels and num_unique_labels are set to the appropriate number in common and number of labels that are unique when the two sets are merged
 	static void GetNodeCommonAndUniqueLabelCounts(EvaluableNode *n1, EvaluableNode *n2, size_t &num_common_labels, size_t &num_unique_labels);
@@ -616,6 +627,18 @@ public:
 			reinterpret_cast<std::atomic<uint8_t>&>(attributes.allAttributes).fetch_and(attrib_with_known_false.allAttributes);
 		}
 	}
+
+	//marks the node as known to be in use, returns true if this call was the one that marked it
+	__forceinline bool TrySetKnownToBeInUseAtomic()
+	{
+		EvaluableNodeAttributesType attrib_with_known_true;
+		attrib_with_known_true.allAttributes = 0;
+		attrib_with_known_true.individualAttribs.knownToBeInUse = true;
+
+		//TODO 15993: once C++20 is widely supported, change type to atomic_ref
+		uint8_t prev_attributes = reinterpret_cast<std::atomic<uint8_t>&>(attributes.allAttributes).fetch_or(attrib_with_known_true.allAttributes);
+		return !(prev_attributes & attrib_with_known_true.allAttributes);
+	}
 #endif
 
 	//returns the number of child nodes regardless of mapped or ordered
@@ -1269,6 +1292,10 @@ public:
 	{
 		if(nodeType == ENIVT_NUMBER)
 		{
+			StringInternPool::StringID cached_sid = string_intern_pool.GetCachedIntegerStringID(nodeValue.number);
+			if(cached_sid != string_intern_pool.NOT_A_STRING_ID)
+				return cached_sid;
+
 			const std::string str_value = EvaluableNode::NumberToString(nodeValue.number);
 			//will return empty string if not found
 			return string_intern_pool.GetIDFromString(str_value);
@@ -1288,6 +1315,10 @@ public:
 	{
 		if(nodeType == ENIVT_NUMBER)
 		{
+			StringInternPool::StringID cached_sid = string_intern_pool.GetCachedIntegerStringID(nodeValue.number);
+			if(cached_sid != string_intern_pool.NOT_A_STRING_ID)
+				return string_intern_pool.CreateStringReference(cached_sid);
+
 			const std::string str_value = EvaluableNode::NumberToString(nodeValue.number);
 			//will return empty string if not found
 			return string_intern_pool.CreateStringReference(str_value);
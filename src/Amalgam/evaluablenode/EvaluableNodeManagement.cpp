@@ -20,6 +20,9 @@ EvaluableNode::ReferenceAssocType EvaluableNodeManager::nodeToParentNodeCache;
 
 const double EvaluableNodeManager::allocExpansionFactor = 1.5;
 
+size_t _gc_soft_memory_limit = 0;
+double _gc_target_overhead = 0.0;
+
 EvaluableNodeManager::~EvaluableNodeManager()
 {
 #ifdef MULTITHREAD_SUPPORT
@@ -176,6 +179,94 @@ void EvaluableNodeManager::UpdateGarbageCollectionTrigger(size_t previous_num_no
 	numNodesToRunGarbageCollection = std::max(max_from_allocation, std::max<size_t>(max_from_previous, max_from_current));
 }
 
+void EvaluableNodeManager::PaceGarbageCollection(size_t num_nodes_before, std::chrono::steady_clock::time_point start_time)
+{
+	auto end_time = std::chrono::steady_clock::now();
+	double collection_seconds = std::chrono::duration<double>(end_time - start_time).count();
+	double mutator_seconds = std::chrono::duration<double>(start_time - gcMetrics.lastCollectionEndTime).count();
+	size_t num_nodes_after = GetNumberOfUsedNodes();
+
+	//nodes that survived the previous collection were not allocated since then
+	size_t num_nodes_allocated = 0;
+	if(num_nodes_before > gcMetrics.numNodesAfterLastCollection)
+		num_nodes_allocated = num_nodes_before - gcMetrics.numNodesAfterLastCollection;
+
+	//smooth the rate so a single burst or lull doesn't dominate the schedule
+	if(mutator_seconds > 0.0)
+	{
+		double allocation_rate = num_nodes_allocated / mutator_seconds;
+		if(gcMetrics.numCollections == 0)
+			gcMetrics.allocationRate = allocation_rate;
+		else
+			gcMetrics.allocationRate = 0.5 * gcMetrics.allocationRate + 0.5 * allocation_rate;
+	}
+
+	gcMetrics.numCollections++;
+	gcMetrics.numNodesBeforeLastCollection = num_nodes_before;
+	gcMetrics.numNodesAfterLastCollection = num_nodes_after;
+	gcMetrics.lastCollectionSeconds = collection_seconds;
+	gcMetrics.totalCollectionSeconds += collection_seconds;
+	gcMetrics.lastCollectionEndTime = end_time;
+	gcMetrics.triggerReason = GCTR_GROWTH;
+
+	//to spend at most _gc_target_overhead of the time collecting, the time until the next collection
+	// must be at least collection_seconds * (1 - overhead) / overhead, during which nodes keep being allocated
+	if(_gc_target_overhead > 0.0 && _gc_target_overhead < 1.0)
+	{
+		double min_seconds_until_next = collection_seconds * (1.0 - _gc_target_overhead) / _gc_target_overhead;
+		size_t paced_num_nodes = num_nodes_after + static_cast<size_t>(gcMetrics.allocationRate * min_seconds_until_next);
+		if(paced_num_nodes > numNodesToRunGarbageCollection)
+		{
+			numNodesToRunGarbageCollection = paced_num_nodes;
+			gcMetrics.triggerReason = GCTR_OVERHEAD;
+		}
+	}
+
+	//the limit is approximate, since it only counts the size of the nodes themselves and the pointers to them
+	size_t soft_memory_limit = GetSoftMemoryLimit();
+	if(soft_memory_limit > 0)
+	{
+		size_t limit_num_nodes = soft_memory_limit / (sizeof(EvaluableNode) + sizeof(EvaluableNode *));
+		if(numNodesToRunGarbageCollection > limit_num_nodes)
+		{
+			//if the nodes in use are already over the limit, collect again after a small amount of growth
+			// rather than after every allocation
+			numNodesToRunGarbageCollection = std::max(limit_num_nodes, num_nodes_after + num_nodes_after / 8 + 1);
+			gcMetrics.triggerReason = GCTR_SOFT_MEMORY_LIMIT;
+		}
+	}
+}
+
+EvaluableNodeReference EvaluableNodeManager::GetGarbageCollectionMetricsAsAssoc()
+{
+	EvaluableNode *metrics = AllocNode(ENT_ASSOC);
+	metrics->ReserveMappedChildNodes(10);
+
+	metrics->SetMappedChildNode("num_collections", AllocNode(static_cast<double>(gcMetrics.numCollections)));
+	metrics->SetMappedChildNode("num_nodes_before_last_collection", AllocNode(static_cast<double>(gcMetrics.numNodesBeforeLastCollection)));
+	metrics->SetMappedChildNode("num_nodes_after_last_collection", AllocNode(static_cast<double>(gcMetrics.numNodesAfterLastCollection)));
+
+	double survival_ratio = 0.0;
+	if(gcMetrics.numNodesBeforeLastCollection > 0)
+		survival_ratio = static_cast<double>(gcMetrics.numNodesAfterLastCollection) / gcMetrics.numNodesBeforeLastCollection;
+	metrics->SetMappedChildNode("survival_ratio", AllocNode(survival_ratio));
+
+	metrics->SetMappedChildNode("last_collection_seconds", AllocNode(gcMetrics.lastCollectionSeconds));
+	metrics->SetMappedChildNode("total_collection_seconds", AllocNode(gcMetrics.totalCollectionSeconds));
+	metrics->SetMappedChildNode("allocation_rate", AllocNode(gcMetrics.allocationRate));
+	metrics->SetMappedChildNode("soft_memory_limit", AllocNode(static_cast<double>(GetSoftMemoryLimit())));
+	metrics->SetMappedChildNode("num_nodes_to_run_collection", AllocNode(static_cast<double>(numNodesToRunGarbageCollection)));
+
+	std::string trigger_reason = "growth";
+	if(gcMetrics.triggerReason == GCTR_OVERHEAD)
+		trigger_reason = "overhead";
+	else if(gcMetrics.triggerReason == GCTR_SOFT_MEMORY_LIMIT)
+		trigger_reason = "soft_memory_limit";
+	metrics->SetMappedChildNode("trigger_reason", AllocNode(ENT_STRING, trigger_reason));
+
+	return EvaluableNodeReference(metrics, true);
+}
+
 #ifdef MULTITHREAD_SUPPORT
 void EvaluableNodeManager::CollectGarbage(Concurrency::ReadLock *memory_modification_lock)
 #else
@@ -208,6 +299,7 @@ void EvaluableNodeManager::CollectGarbage()
 		if(RecommendGarbageCollection())
 		{
 #endif
+			auto start_time = std::chrono::steady_clock::now();
 			size_t cur_first_unused_node_index = firstUnusedNodeIndex;
 			//clear firstUnusedNodeIndex to signal to other threads that they won't need to do garbage collection
 			firstUnusedNodeIndex = 0;
@@ -222,6 +314,8 @@ void EvaluableNodeManager::CollectGarbage()
 
 			FreeAllNodesExceptReferencedNodes(cur_first_unused_node_index);
 
+			PaceGarbageCollection(cur_first_unused_node_index, start_time);
+
 #ifdef MULTITHREAD_SUPPORT
 		}
 
@@ -842,54 +936,34 @@ void EvaluableNodeManager::MarkAllReferencedNodesInUse(size_t estimated_nodes_in
 	//because code cannot be executed when in garbage collection due to other locks,
 	//the nodes referenced cannot be modified while in this method, so nr.mutex does not need to be locked
 
-	size_t reference_count = nr.nodesReferenced.size();
-	//heuristic to ensure there's enough to do to warrant the overhead of using multiple threads
-	if(Concurrency::GetMaxNumThreads() > 1 && reference_count > 0 && (estimated_nodes_in_use / (reference_count + 1)) >= 1000)
+	//heuristic to ensure there's enough to do to warrant the overhead of using multiple threads;
+	// large trees are split up while being marked, so a single root can still use all threads
+	if(Concurrency::GetMaxNumThreads() > 1 && estimated_nodes_in_use >= 8 * markInUseChunkSize)
 	{
-		//allocate all the tasks assuming they will happen, but mark when they can be skipped
-		ThreadPool::CountableTaskSet task_set(1 + nr.nodesReferenced.size());
+		ThreadPool::CountableTaskSet task_set;
 
 		//start processing root node first, as there's a good chance it will be the largest
 		if(root_node != nullptr && !root_node->GetKnownToBeInUseAtomic())
-		{
-			//don't enqueue in batch, as threads racing ahead of others will reduce memory
-			//contention
-			Concurrency::urgentThreadPool.EnqueueTask(
-				[root_node, &task_set]
-				{
-					MarkAllReferencedNodesInUseRecurseConcurrent(root_node);
-					task_set.MarkTaskCompleted();
-				}
-			);
-		}
-		else //autocompleted
-		{
-			task_set.MarkTaskCompletedBeforeWaitForTasks();
-		}
+			EnqueueMarkAllReferencedNodesInUseTask(std::vector<EvaluableNode *>{ root_node }, task_set);
 
-		for(auto &[enr, _] : nr.nodesReferenced)
+		//group the remaining references into chunks so small references don't each need a task
+		std::vector<EvaluableNode *> nodes_to_mark;
+		for(auto &[en, _] : nr.nodesReferenced)
 		{
-			//some compilers are pedantic about the types passed into the lambda, so make a copy
-			EvaluableNode *en = enr;
-			//only enqueue a task if the top node isn't known to be in use
-			if(en != nullptr && !en->GetKnownToBeInUseAtomic())
-			{
-				//don't enqueue in batch, as threads racing ahead of others will reduce memory
-				//contention
-				Concurrency::urgentThreadPool.EnqueueTask(
-					[en, &task_set]
-					{
-						MarkAllReferencedNodesInUseRecurseConcurrent(en);
-						task_set.MarkTaskCompleted();
-					}
-				);
-			}
-			else //autocompleted
+			if(en == nullptr || en->GetKnownToBeInUseAtomic())
+				continue;
+
+			nodes_to_mark.push_back(en);
+			if(nodes_to_mark.size() >= markInUseChunkSize)
 			{
-				task_set.MarkTaskCompletedBeforeWaitForTasks();
+				EnqueueMarkAllReferencedNodesInUseTask(std::move(nodes_to_mark), task_set);
+				nodes_to_mark.clear();
 			}
 		}
 
+		if(nodes_to_mark.size() > 0)
+			EnqueueMarkAllReferencedNodesInUseTask(std::move(nodes_to_mark), task_set);
+
 		Concurrency::urgentThreadPool.ChangeCurrentThreadStateFromActiveToWaiting();
 
 		task_set.WaitForTasks();
@@ -900,16 +974,19 @@ void EvaluableNodeManager::MarkAllReferencedNodesInUse(size_t estimated_nodes_in
 	}
 #endif
 
-	//check for null or insertion before calling recursion to minimize number of branches (slight performance improvement)
+	//reuse the same stack for all of the trees
+	std::vector<EvaluableNode *> nodes_to_mark;
+
+	//check for null or insertion before traversing to minimize number of branches (slight performance improvement)
 	if(root_node != nullptr && !root_node->GetKnownToBeInUse())
-		MarkAllReferencedNodesInUseRecurse(root_node);
+		MarkAllReferencedNodesInUseIterative(root_node, nodes_to_mark);
 
 	for(auto &[t, _] : nr.nodesReferenced)
 	{
 		if(t == nullptr || t->GetKnownToBeInUse())
 			continue;
 
-		MarkAllReferencedNodesInUseRecurse(t);
+		MarkAllReferencedNodesInUseIterative(t, nodes_to_mark);
 	}
 }
 
@@ -1007,60 +1084,136 @@ std::pair<bool, bool> EvaluableNodeManager::UpdateFlagsForNodeTreeRecurse(Evalua
 	}
 }
 
-void EvaluableNodeManager::MarkAllReferencedNodesInUseRecurse(EvaluableNode *tree)
+void EvaluableNodeManager::MarkAllReferencedNodesInUseIterative(EvaluableNode *tree, std::vector<EvaluableNode *> &nodes_to_mark)
 {
-#ifdef AMALGAM_FAST_MEMORY_INTEGRITY
-	assert(!tree->IsNodeDeallocated());
-#endif
-
-	//if entering this function, then the node hasn't been marked yet
+	//nodes are marked when pushed so that each node is only pushed once
 	tree->SetKnownToBeInUse(true);
+	nodes_to_mark.push_back(tree);
 
-	if(tree->IsAssociativeArray())
+	while(!nodes_to_mark.empty())
 	{
-		for(auto &[_, e] : tree->GetMappedChildNodesReference())
+		EvaluableNode *en = nodes_to_mark.back();
+		nodes_to_mark.pop_back();
+
+	#ifdef AMALGAM_FAST_MEMORY_INTEGRITY
+		assert(!en->IsNodeDeallocated());
+	#endif
+
+		if(en->IsAssociativeArray())
 		{
-			if(e != nullptr && !e->GetKnownToBeInUse())
-				MarkAllReferencedNodesInUseRecurse(e);
+			for(auto &[_, e] : en->GetMappedChildNodesReference())
+			{
+				if(e != nullptr && !e->GetKnownToBeInUse())
+				{
+					e->SetKnownToBeInUse(true);
+					nodes_to_mark.push_back(e);
+				}
+			}
 		}
-	}
-	else if(!tree->IsImmediate())
-	{
-		for(auto &e : tree->GetOrderedChildNodesReference())
+		else if(!en->IsImmediate())
 		{
-			if(e != nullptr && !e->GetKnownToBeInUse())
-				MarkAllReferencedNodesInUseRecurse(e);
+			for(auto &e : en->GetOrderedChildNodesReference())
+			{
+				if(e != nullptr && !e->GetKnownToBeInUse())
+				{
+					e->SetKnownToBeInUse(true);
+					nodes_to_mark.push_back(e);
+				}
+			}
 		}
-	}	
+	}
 }
 
 #ifdef MULTITHREAD_SUPPORT
-void EvaluableNodeManager::MarkAllReferencedNodesInUseRecurseConcurrent(EvaluableNode* tree)
+void EvaluableNodeManager::MarkAllReferencedNodesInUseConcurrent(std::vector<EvaluableNode *> &nodes_to_mark,
+	ThreadPool::CountableTaskSet &task_set)
 {
-#ifdef AMALGAM_FAST_MEMORY_INTEGRITY
-	assert(!tree->IsNodeDeallocated());
-#endif
+	//nodes are claimed when popped, so any thread may push a node but only one will traverse it
+	size_t nodes_until_split_check = markInUseChunkSize;
 
-	//if entering this function, then the node hasn't been marked yet
-	tree->SetKnownToBeInUseAtomic(true);
-
-	if(tree->IsAssociativeArray())
+	while(!nodes_to_mark.empty())
 	{
-		for(auto &[_, e] : tree->GetMappedChildNodesReference())
+		EvaluableNode *en = nodes_to_mark.back();
+		nodes_to_mark.pop_back();
+
+		//chunks of child nodes handed off from other threads may contain nullptr
+		if(en == nullptr || !en->TrySetKnownToBeInUseAtomic())
+			continue;
+
+	#ifdef AMALGAM_FAST_MEMORY_INTEGRITY
+		assert(!en->IsNodeDeallocated());
+	#endif
+
+		if(en->IsAssociativeArray())
 		{
-			if(e != nullptr && !e->GetKnownToBeInUseAtomic())
-				MarkAllReferencedNodesInUseRecurseConcurrent(e);
+			for(auto &[_, e] : en->GetMappedChildNodesReference())
+			{
+				if(e != nullptr && !e->GetKnownToBeInUseAtomic())
+					nodes_to_mark.push_back(e);
+			}
 		}
-	}
-	else if(!tree->IsImmediate())
-	{
-		for(auto &e : tree->GetOrderedChildNodesReference())
+		else if(!en->IsImmediate())
 		{
-			if(e != nullptr && !e->GetKnownToBeInUseAtomic())
-				MarkAllReferencedNodesInUseRecurseConcurrent(e);
+			auto &ocn = en->GetOrderedChildNodesReference();
+			size_t start_index = 0;
+
+			//hand off all but the first chunk of wide lists if there are threads to take them
+			if(ocn.size() > 2 * markInUseChunkSize && Concurrency::urgentThreadPool.AreThreadsAvailable())
+			{
+				start_index = ocn.size() - markInUseChunkSize;
+				for(size_t chunk_start = markInUseChunkSize; chunk_start < start_index; chunk_start += markInUseChunkSize)
+				{
+					size_t chunk_end = std::min(chunk_start + markInUseChunkSize, start_index);
+					EnqueueMarkAllReferencedNodesInUseTask(
+						std::vector<EvaluableNode *>(begin(ocn) + chunk_start, begin(ocn) + chunk_end), task_set);
+				}
+
+				for(size_t i = 0; i < markInUseChunkSize; i++)
+				{
+					EvaluableNode *e = ocn[i];
+					if(e != nullptr && !e->GetKnownToBeInUseAtomic())
+						nodes_to_mark.push_back(e);
+				}
+			}
+
+			for(size_t i = start_index; i < ocn.size(); i++)
+			{
+				EvaluableNode *e = ocn[i];
+				if(e != nullptr && !e->GetKnownToBeInUseAtomic())
+					nodes_to_mark.push_back(e);
+			}
+		}
+
+		//periodically give the oldest half of the pending nodes to an idle thread,
+		// which are typically the nodes nearest the root with the most work beneath them
+		if(--nodes_until_split_check == 0)
+		{
+			nodes_until_split_check = markInUseChunkSize;
+			if(nodes_to_mark.size() >= 2 * markInUseChunkSize && Concurrency::urgentThreadPool.AreThreadsAvailable())
+			{
+				auto split_point = begin(nodes_to_mark) + nodes_to_mark.size() / 2;
+				EnqueueMarkAllReferencedNodesInUseTask(std::vector<EvaluableNode *>(begin(nodes_to_mark), split_point), task_set);
+				nodes_to_mark.erase(begin(nodes_to_mark), split_point);
+			}
 		}
 	}
 }
+
+void EvaluableNodeManager::EnqueueMarkAllReferencedNodesInUseTask(std::vector<EvaluableNode *> &&nodes_to_mark,
+	ThreadPool::CountableTaskSet &task_set)
+{
+	//the task must be counted before it can complete
+	task_set.AddTask();
+
+	//don't enqueue in batch, as threads racing ahead of others will reduce memory contention
+	Concurrency::urgentThreadPool.EnqueueTask(
+		[nodes = std::move(nodes_to_mark), &task_set]() mutable
+		{
+			MarkAllReferencedNodesInUseConcurrent(nodes, task_set);
+			task_set.MarkTaskCompleted();
+		}
+	);
+}
 #endif
 
 std::pair<bool, bool> EvaluableNodeManager::ValidateEvaluableNodeTreeMemoryIntegrityRecurse(
@@ -5,6 +5,7 @@
 #include "EvaluableNode.h"
 
 //system headers:
+#include <chrono>
 #include <memory>
 
 //if the macro PEDANTIC_GARBAGE_COLLECTION is defined, then garbage collection will be performed
@@ -13,6 +14,11 @@
 typedef int64_t ExecutionCycleCount;
 typedef int32_t ExecutionCycleCountCompactDelta;
 
+//soft limit in bytes for the nodes of each EvaluableNodeManager that does not have its own limit, 0 if no limit
+extern size_t _gc_soft_memory_limit;
+//target fraction of time spent collecting garbage, used to space out collections when allocating quickly; 0 to disable
+extern double _gc_target_overhead;
+
 //describes an EvaluableNode value and whether it is uniquely referenced
 //this is mostly used for actual EvaluableNode *'s, and so most of the methods are built as such
 //however, if it may contain an immediate value, then that must be checked via IsImmediateValue()
@@ -630,6 +636,51 @@ public:
 	//updates the memory threshold when garbage collection will be next called
 	void UpdateGarbageCollectionTrigger(size_t previous_num_nodes = 0);
 
+	//what determined the current value of numNodesToRunGarbageCollection
+	enum GarbageCollectionTriggerReason
+	{
+		//growth relative to the nodes in use
+		GCTR_GROWTH,
+		//spaced out to meet _gc_target_overhead given the allocation rate
+		GCTR_OVERHEAD,
+		//capped by the soft memory limit
+		GCTR_SOFT_MEMORY_LIMIT
+	};
+
+	//statistics about the garbage collections performed and how the next one is scheduled
+	struct GarbageCollectionMetrics
+	{
+		size_t numCollections = 0;
+		size_t numNodesBeforeLastCollection = 0;
+		size_t numNodesAfterLastCollection = 0;
+		double lastCollectionSeconds = 0.0;
+		double totalCollectionSeconds = 0.0;
+		//nodes allocated per second between collections, smoothed across collections
+		double allocationRate = 0.0;
+		GarbageCollectionTriggerReason triggerReason = GCTR_GROWTH;
+		std::chrono::steady_clock::time_point lastCollectionEndTime = std::chrono::steady_clock::now();
+	};
+
+	//returns the soft memory limit in bytes that applies to this manager, 0 if none
+	inline size_t GetSoftMemoryLimit()
+	{
+		return (softMemoryLimit > 0 ? softMemoryLimit : _gc_soft_memory_limit);
+	}
+
+	//sets the soft memory limit in bytes for this manager, 0 to use _gc_soft_memory_limit
+	inline void SetSoftMemoryLimit(size_t num_bytes)
+	{
+		softMemoryLimit = num_bytes;
+	}
+
+	inline const GarbageCollectionMetrics &GetGarbageCollectionMetrics()
+	{
+		return gcMetrics;
+	}
+
+	//returns gcMetrics as an assoc allocated from this manager
+	EvaluableNodeReference GetGarbageCollectionMetricsAsAssoc();
+
 	//runs heuristics and collects garbage
 #ifdef MULTITHREAD_SUPPORT
 	//if multithreaded, then memory_modification_lock is the lock used for memoryModificationMutex if not nullptr
@@ -921,6 +972,10 @@ public:
 	size_t numNodesToRunGarbageCollection;
 
 protected:
+	//records the collection that started at start_time with num_nodes_before nodes in use,
+	// and adjusts numNodesToRunGarbageCollection for the allocation rate, _gc_target_overhead, and the soft memory limit
+	void PaceGarbageCollection(size_t num_nodes_before, std::chrono::steady_clock::time_point start_time);
+
 	//allocates an EvaluableNode of the respective memory type in the appropriate way
 	// returns an uninitialized EvaluableNode -- care must be taken to set fields properly
 	EvaluableNode *AllocUninitializedNode();
@@ -973,13 +1028,21 @@ protected:
 	static std::pair<bool, bool> UpdateFlagsForNodeTreeRecurse(EvaluableNode *tree, EvaluableNode *parent,
 		EvaluableNode::ReferenceAssocType &checked_to_parent);
 
-	//sets or clears all referenced nodes' in use flags
-	//if set_in_use is true, then it will set the value, if false, it will clear the value
-	//note that tree cannot be nullptr and it should already be inserted into the references prior to calling
-	static void MarkAllReferencedNodesInUseRecurse(EvaluableNode *tree);
+	//marks all nodes reachable from tree as in use, using nodes_to_mark as an explicit stack
+	// so that deep trees do not recurse; nodes_to_mark is expected to be empty and is left empty
+	//note that tree cannot be nullptr
+	static void MarkAllReferencedNodesInUseIterative(EvaluableNode *tree, std::vector<EvaluableNode *> &nodes_to_mark);
 
 #ifdef MULTITHREAD_SUPPORT
-	static void MarkAllReferencedNodesInUseRecurseConcurrent(EvaluableNode* tree);
+	//marks all nodes reachable from nodes_to_mark as in use, using nodes_to_mark as an explicit stack
+	//when other threads are idle, hands off chunks of wide child arrays and half of the pending stack
+	// as new tasks in task_set, so that a single large tree can be marked by all threads
+	static void MarkAllReferencedNodesInUseConcurrent(std::vector<EvaluableNode *> &nodes_to_mark,
+		ThreadPool::CountableTaskSet &task_set);
+
+	//adds a task to task_set that marks all nodes reachable from nodes_to_mark
+	static void EnqueueMarkAllReferencedNodesInUseTask(std::vector<EvaluableNode *> &&nodes_to_mark,
+		ThreadPool::CountableTaskSet &task_set);
 #endif
 
 	//helper method for ValidateEvaluableNodeTreeMemoryIntegrity
@@ -1027,6 +1090,15 @@ protected:
 		static EvaluableNode::ReferenceAssocType nodeToParentNodeCache;
 
 
+	//soft limit in bytes for the nodes of this manager, 0 to use _gc_soft_memory_limit
+	size_t softMemoryLimit = 0;
+
+	GarbageCollectionMetrics gcMetrics;
+
 	//extra space to allocate when allocating
 	static const double allocExpansionFactor;
+
+	//number of nodes handed off at a time when marking nodes in use concurrently,
+	// and the number of nodes marked between checks for idle threads
+	static constexpr size_t markInUseChunkSize = 1024;
 };
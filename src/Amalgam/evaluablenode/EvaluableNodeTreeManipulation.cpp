@@ -2098,6 +2098,7 @@ CompactHashMap<EvaluableNodeType, double> EvaluableNodeTreeManipulation::evaluab
 	//entity query
 	{ENT_CONTAINED_ENTITIES,							0.3},
 	{ENT_COMPUTE_ON_CONTAINED_ENTITIES,					0.3},
+	{ENT_CACHE_CONTAINED_ENTITY_LABELS,					0.02},
 	{ENT_QUERY_SELECT,									0.2},
 	{ENT_QUERY_SAMPLE,									0.2},
 	{ENT_QUERY_WEIGHTED_SAMPLE,							0.2},
@@ -2140,7 +2141,8 @@ CompactHashMap<EvaluableNodeType, double> EvaluableNodeTreeManipulation::evaluab
 	{ENT_DIRECT_RETRIEVE_FROM_ENTITY,					0.01},
 	{ENT_CALL_ENTITY,									0.5},
 	{ENT_CALL_ENTITY_GET_CHANGES,						0.05},
-	{ENT_CALL_CONTAINER,								0.5}
+	{ENT_CALL_CONTAINER,								0.5},
+	{ENT_CALL_ON_CONTAINED_ENTITIES,					0.05}
 };
 
 EvaluableNodeTreeManipulation::MutationParameters::WeightedRandEvaluableNodeType EvaluableNodeTreeManipulation::evaluableNodeTypeRandomStream(evaluableNodeTypeProbabilities, true);
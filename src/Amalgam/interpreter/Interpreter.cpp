@@ -25,6 +25,16 @@ thread_local
 #endif
 	std::vector<EntityQueryCondition> Interpreter::conditionsBuffer;
 
+#if defined(MULTITHREAD_SUPPORT) || defined(MULTITHREAD_INTERFACE)
+thread_local
+#endif
+	std::vector<std::unique_ptr<Interpreter>> Interpreter::interpreterPool;
+
+#if defined(MULTITHREAD_SUPPORT) || defined(MULTITHREAD_INTERFACE)
+thread_local
+#endif
+	std::vector<std::vector<EvaluableNode *>> Interpreter::stackBufferPool;
+
 std::array<Interpreter::OpcodeFunction, ENT_NOT_A_BUILT_IN_TYPE + 1> Interpreter::_opcodes = {
 	
 	//built-in / system specific
@@ -251,6 +261,7 @@ std::array<Interpreter::OpcodeFunction, ENT_NOT_A_BUILT_IN_TYPE + 1> Interpreter
 	//entity query
 	&Interpreter::InterpretNode_ENT_CONTAINED_ENTITIES_and_COMPUTE_ON_CONTAINED_ENTITIES,			// ENT_CONTAINED_ENTITIES
 	&Interpreter::InterpretNode_ENT_CONTAINED_ENTITIES_and_COMPUTE_ON_CONTAINED_ENTITIES,			// ENT_COMPUTE_ON_CONTAINED_ENTITIES
+	&Interpreter::InterpretNode_ENT_CACHE_CONTAINED_ENTITY_LABELS,									// ENT_CACHE_CONTAINED_ENTITY_LABELS
 	&Interpreter::InterpretNode_ENT_QUERY_and_COMPUTE_opcodes,										// ENT_QUERY_SELECT
 	&Interpreter::InterpretNode_ENT_QUERY_and_COMPUTE_opcodes,										// ENT_QUERY_SAMPLE
 	&Interpreter::InterpretNode_ENT_QUERY_and_COMPUTE_opcodes,										// ENT_QUERY_WEIGHTED_SAMPLE
@@ -295,6 +306,7 @@ std::array<Interpreter::OpcodeFunction, ENT_NOT_A_BUILT_IN_TYPE + 1> Interpreter
 	&Interpreter::InterpretNode_ENT_CALL_ENTITY_and_CALL_ENTITY_GET_CHANGES,						// ENT_CALL_ENTITY
 	&Interpreter::InterpretNode_ENT_CALL_ENTITY_and_CALL_ENTITY_GET_CHANGES,						// ENT_CALL_ENTITY_GET_CHANGES
 	&Interpreter::InterpretNode_ENT_CALL_CONTAINER,													// ENT_CALL_CONTAINER
+	&Interpreter::InterpretNode_ENT_CALL_ON_CONTAINED_ENTITIES,										// ENT_CALL_ON_CONTAINED_ENTITIES
 
 	//not in active memory
 	&Interpreter::InterpretNode_ENT_DEALLOCATED,													// ENT_DEALLOCATED
@@ -308,6 +320,13 @@ std::array<Interpreter::OpcodeFunction, ENT_NOT_A_BUILT_IN_TYPE + 1> Interpreter
 Interpreter::Interpreter(EvaluableNodeManager *enm, RandomStream rand_stream,
 	std::vector<EntityWriteListener *> *write_listeners, PrintListener *print_listener,
 	PerformanceConstraints *performance_constraints, Entity *t, Interpreter *calling_interpreter)
+{
+	Reinitialize(enm, rand_stream, write_listeners, print_listener, performance_constraints, t, calling_interpreter);
+}
+
+void Interpreter::Reinitialize(EvaluableNodeManager *enm, RandomStream rand_stream,
+	std::vector<EntityWriteListener *> *write_listeners, PrintListener *print_listener,
+	PerformanceConstraints *performance_constraints, Entity *t, Interpreter *calling_interpreter)
 {
 	performanceConstraints = performance_constraints;
 
@@ -320,8 +339,39 @@ Interpreter::Interpreter(EvaluableNodeManager *enm, RandomStream rand_stream,
 	callStackNodes = nullptr;
 	interpreterNodeStackNodes = nullptr;
 	constructionStackNodes = nullptr;
+	constructionStackIndicesAndUniqueness.clear();
 
 	evaluableNodeManager = enm;
+
+#ifdef MULTITHREAD_SUPPORT
+	memoryModificationLock = Concurrency::ReadLock();
+#endif
+}
+
+std::unique_ptr<Interpreter> Interpreter::AcquireInterpreter(EvaluableNodeManager *enm, RandomStream rand_stream,
+	std::vector<EntityWriteListener *> *write_listeners, PrintListener *print_listener,
+	PerformanceConstraints *performance_constraints, Entity *t, Interpreter *calling_interpreter)
+{
+	if(interpreterPool.size() == 0)
+		return std::make_unique<Interpreter>(enm, rand_stream, write_listeners, print_listener,
+			performance_constraints, t, calling_interpreter);
+
+	std::unique_ptr<Interpreter> interpreter = std::move(interpreterPool.back());
+	interpreterPool.pop_back();
+	interpreter->Reinitialize(enm, rand_stream, write_listeners, print_listener,
+		performance_constraints, t, calling_interpreter);
+	return interpreter;
+}
+
+void Interpreter::ReleaseInterpreter(std::unique_ptr<Interpreter> interpreter)
+{
+#ifdef MULTITHREAD_SUPPORT
+	//don't retain any lock on memory while pooled
+	interpreter->memoryModificationLock = Concurrency::ReadLock();
+#endif
+
+	if(interpreterPool.size() < maxNumPooledPerThread)
+		interpreterPool.emplace_back(std::move(interpreter));
 }
 
 #ifdef MULTITHREAD_SUPPORT
@@ -359,11 +409,26 @@ EvaluableNodeReference Interpreter::ExecuteNode(EvaluableNode *en,
 		call_stack->AppendOrderedChildNode(new_context_entry);
 	}
 
+	//new stacks reuse the capacity of pooled buffers
 	if(interpreter_node_stack == nullptr)
+	{
 		interpreter_node_stack = evaluableNodeManager->AllocNode(ENT_LIST);
+		if(stackBufferPool.size() > 0)
+		{
+			interpreter_node_stack->GetOrderedChildNodesReference().swap(stackBufferPool.back());
+			stackBufferPool.pop_back();
+		}
+	}
 
 	if(construction_stack == nullptr)
+	{
 		construction_stack = evaluableNodeManager->AllocNode(ENT_LIST);
+		if(stackBufferPool.size() > 0)
+		{
+			construction_stack->GetOrderedChildNodesReference().swap(stackBufferPool.back());
+			stackBufferPool.pop_back();
+		}
+	}
 
 	callStackNodes = &call_stack->GetOrderedChildNodes();
 	interpreterNodeStackNodes = &interpreter_node_stack->GetOrderedChildNodes();
@@ -387,6 +452,18 @@ EvaluableNodeReference Interpreter::ExecuteNode(EvaluableNode *en,
 
 	evaluableNodeManager->FreeNodeReferences(call_stack, interpreter_node_stack, construction_stack);
 
+	//retain the buffers of the stacks for subsequent interpreters on this thread
+	for(EvaluableNode *stack : { interpreter_node_stack, construction_stack })
+	{
+		auto &stack_buffer = stack->GetOrderedChildNodesReference();
+		if(stackBufferPool.size() < maxNumPooledPerThread
+				&& stack_buffer.capacity() > 0 && stack_buffer.capacity() <= maxPooledStackBufferCapacity)
+		{
+			stack_buffer.clear();
+			stackBufferPool.emplace_back(std::move(stack_buffer));
+		}
+	}
+
 	//remove these nodes
 	evaluableNodeManager->FreeNode(interpreter_node_stack);
 	evaluableNodeManager->FreeNode(construction_stack);
@@ -161,6 +161,22 @@ public:
 	~Interpreter()
 	{	}
 
+	//reinitializes the interpreter as if it had been newly constructed with the parameters,
+	// but retains any buffer capacity so that the interpreter can be reused
+	void Reinitialize(EvaluableNodeManager *enm, RandomStream rand_stream,
+		std::vector<EntityWriteListener *> *write_listeners, PrintListener *print_listener,
+		PerformanceConstraints *performance_constraints = nullptr,
+		Entity *t = nullptr, Interpreter *calling_interpreter = nullptr);
+
+	//returns an interpreter initialized with the parameters, reusing one from the pool of the current thread if available
+	static std::unique_ptr<Interpreter> AcquireInterpreter(EvaluableNodeManager *enm, RandomStream rand_stream,
+		std::vector<EntityWriteListener *> *write_listeners, PrintListener *print_listener,
+		PerformanceConstraints *performance_constraints = nullptr,
+		Entity *t = nullptr, Interpreter *calling_interpreter = nullptr);
+
+	//returns interpreter to the pool of the current thread so it can be reused by AcquireInterpreter
+	static void ReleaseInterpreter(std::unique_ptr<Interpreter> interpreter);
+
 	//Executes the current Entity that this Interpreter is contained by
 	// sets up all of the stack and contextual structures, then calls InterpretNode on en
 	//if call_stack, interpreter_node_stack, or construction_stack are nullptr, it will start with a new one
@@ -487,6 +503,16 @@ public:
 		return InterpretNode(n, immediate_result);
 	}
 
+	//returns the result of evaluating the idempotent node en
+	// if nothing in the tree has metadata, then en is its own value and is returned without copying,
+	// otherwise returns a copy without any metadata
+	__forceinline EvaluableNodeReference InterpretIdempotentNode(EvaluableNode *en)
+	{
+		if(!en->GetNeedCycleCheck() && EvaluableNode::IsNodeTreeFreeOfMetadata(en))
+			return EvaluableNodeReference(en, false);
+		return evaluableNodeManager->DeepAllocCopy(en, EvaluableNodeManager::ENMM_REMOVE_ALL);
+	}
+
 	//computes a unary numeric function on the given node
 	__forceinline EvaluableNodeReference InterpretNodeUnaryNumericOperation(EvaluableNode *n, bool immediate_result,
 		std::function<double(double)> func)
@@ -541,6 +567,11 @@ public:
 	//StringRef is an allocated string reference, and the caller is responsible for freeing it
 	std::pair<EntityWriteReference, StringRef> InterpretNodeIntoDestinationEntity(EvaluableNode *n);
 
+	//destroys the entities directly contained by curEntity whose ids are the ordered child nodes of id_nodes,
+	// removing them from curEntity as one batch
+	//returns true if all of the entities were destroyed
+	bool DestroyContainedEntities(EvaluableNode *id_nodes);
+
 	//traverses source based on traversal path list tpl
 	// If create_destination_if_necessary is set, then it will expand anything in the source as appropriate
 	//Returns the location of the EvaluableNode * of the destination, nullptr if it does not exist
@@ -664,7 +695,7 @@ protected:
 			for(size_t element_index = 0; element_index < numTasks; element_index++)
 			{
 				//create interpreter
-				interpreters.emplace_back(std::make_unique<Interpreter>(parentInterpreter->evaluableNodeManager,
+				interpreters.emplace_back(AcquireInterpreter(parentInterpreter->evaluableNodeManager,
 					parentInterpreter->randomStream.CreateOtherStreamViaRand(),
 					parentInterpreter->writeListeners, parentInterpreter->printListener,
 					parentInterpreter->performanceConstraints, parentInterpreter->curEntity));
@@ -674,6 +705,12 @@ protected:
 			parentInterpreter->memoryModificationLock.unlock();
 		}
 
+		~ConcurrencyManager()
+		{
+			for(auto &interpreter : interpreters)
+				ReleaseInterpreter(std::move(interpreter));
+		}
+
 		//Enqueues a concurrent task that needs a construction stack, using the relative interpreter
 		// executes node_to_execute with the following parameters matching those of pushing on the construction stack
 		// will allocate an appropriate node matching the type of current_index
@@ -1227,6 +1264,7 @@ protected:
 
 	//entity query
 	EvaluableNodeReference InterpretNode_ENT_CONTAINED_ENTITIES_and_COMPUTE_ON_CONTAINED_ENTITIES(EvaluableNode *en, bool immediate_result);
+	EvaluableNodeReference InterpretNode_ENT_CACHE_CONTAINED_ENTITY_LABELS(EvaluableNode *en, bool immediate_result);
 	EvaluableNodeReference InterpretNode_ENT_QUERY_and_COMPUTE_opcodes(EvaluableNode *en, bool immediate_result);
 
 	//entity access
@@ -1236,6 +1274,7 @@ protected:
 	EvaluableNodeReference InterpretNode_ENT_RETRIEVE_FROM_ENTITY_and_DIRECT_RETRIEVE_FROM_ENTITY(EvaluableNode *en, bool immediate_result);
 	EvaluableNodeReference InterpretNode_ENT_CALL_ENTITY_and_CALL_ENTITY_GET_CHANGES(EvaluableNode *en, bool immediate_result);
 	EvaluableNodeReference InterpretNode_ENT_CALL_CONTAINER(EvaluableNode *en, bool immediate_result);
+	EvaluableNodeReference InterpretNode_ENT_CALL_ON_CONTAINED_ENTITIES(EvaluableNode *en, bool immediate_result);
 
 	EvaluableNodeReference InterpretNode_ENT_DEALLOCATED(EvaluableNode *en, bool immediate_result);
 	EvaluableNodeReference InterpretNode_ENT_NOT_A_BUILT_IN_TYPE(EvaluableNode *en, bool immediate_result);
@@ -1288,6 +1327,26 @@ protected:
 #endif
 		static std::vector<EntityQueryCondition> conditionsBuffer;
 
+	//interpreters that are no longer in use, retaining their buffer capacity, to be reused by AcquireInterpreter
+	//one pool per thread so no locking is needed
+#if defined(MULTITHREAD_SUPPORT) || defined(MULTITHREAD_INTERFACE)
+	thread_local
+#endif
+		static std::vector<std::unique_ptr<Interpreter>> interpreterPool;
+
+	//buffers for interpreter node stacks and construction stacks that are no longer in use, retaining their capacity
+	//one pool per thread so no locking is needed
+#if defined(MULTITHREAD_SUPPORT) || defined(MULTITHREAD_INTERFACE)
+	thread_local
+#endif
+		static std::vector<std::vector<EvaluableNode *>> stackBufferPool;
+
+	//maximum number of interpreters and stack buffers retained in each pool per thread
+	static constexpr size_t maxNumPooledPerThread = 64;
+
+	//stack buffers larger than this capacity are released rather than retained in stackBufferPool
+	static constexpr size_t maxPooledStackBufferCapacity = 4096;
+
 	//the interpreter that called this one -- used for debugging
 	Interpreter *callingInterpreter;
 
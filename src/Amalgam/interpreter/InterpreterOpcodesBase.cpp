@@ -170,6 +170,37 @@ EvaluableNodeReference Interpreter::InterpretNode_ENT_SYSTEM(EvaluableNode *en,
 
 		return AllocReturn(GetEntityMemorySizeDiagnostics(curEntity), immediate_result);
 	}
+	else if(command == "gc_metrics")
+	{
+		return curEntity->evaluableNodeManager.GetGarbageCollectionMetricsAsAssoc();
+	}
+	else if(command == "reorder_contained_entities" && ocn.size() > 1)
+	{
+		auto features_node = InterpretNodeForImmediateUse(ocn[1]);
+		std::vector<StringInternPool::StringID> feature_sids;
+		if(features_node != nullptr)
+		{
+			for(auto &cn : features_node->GetOrderedChildNodes())
+			{
+				StringInternPool::StringID feature_sid = EvaluableNode::ToStringIDIfExists(cn);
+				if(feature_sid != string_intern_pool.NOT_A_STRING_ID)
+					feature_sids.push_back(feature_sid);
+			}
+		}
+		evaluableNodeManager->FreeNodeTreeIfPossible(features_node);
+
+		EntityWriteReference container;
+		if(ocn.size() > 2)
+			container = InterpretNodeIntoRelativeSourceEntityWriteReference(ocn[2]);
+		else
+			container = EntityWriteReference(curEntity);
+
+		if(container == nullptr)
+			return EvaluableNodeReference::Null();
+
+		container->ReorderContainedEntities(feature_sids);
+		return AllocReturn(true, immediate_result);
+	}
 	else if(command == "validate")
 	{
 		VerifyEvaluableNodeIntegrity();
@@ -441,9 +472,9 @@ EvaluableNodeReference Interpreter::InterpretNode_ENT_CONCLUDE_and_RETURN(Evalua
 	if(ocn.size() == 0)
 		return EvaluableNodeReference(en, false);
 
-	//if idempotent, can just return a copy without any metadata
+	//if idempotent, it evaluates to itself
 	if(en->GetIsIdempotent())
-		return evaluableNodeManager->DeepAllocCopy(en, EvaluableNodeManager::ENMM_REMOVE_ALL);
+		return InterpretIdempotentNode(en);
 
 	EvaluableNodeReference value = InterpretNode(ocn[0]);
 
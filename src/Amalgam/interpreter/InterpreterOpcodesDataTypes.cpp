@@ -43,9 +43,9 @@ EvaluableNodeReference Interpreter::InterpretNode_ENT_NULL(EvaluableNode *en, bo
 
 EvaluableNodeReference Interpreter::InterpretNode_ENT_LIST(EvaluableNode *en, bool immediate_result)
 {
-	//if idempotent, can just return a copy without any metadata
+	//if idempotent, it evaluates to itself
 	if(en->GetIsIdempotent())
-		return evaluableNodeManager->DeepAllocCopy(en, EvaluableNodeManager::ENMM_REMOVE_ALL);
+		return InterpretIdempotentNode(en);
 
 	EvaluableNodeReference new_list(evaluableNodeManager->AllocNode(ENT_LIST), true);
 
@@ -103,9 +103,9 @@ EvaluableNodeReference Interpreter::InterpretNode_ENT_LIST(EvaluableNode *en, bo
 
 EvaluableNodeReference Interpreter::InterpretNode_ENT_ASSOC(EvaluableNode *en, bool immediate_result)
 {
-	//if idempotent, can just return a copy without any metadata
+	//if idempotent, it evaluates to itself
 	if(en->GetIsIdempotent())
-		return evaluableNodeManager->DeepAllocCopy(en, EvaluableNodeManager::ENMM_REMOVE_ALL);
+		return InterpretIdempotentNode(en);
 
 	//create a new assoc from the previous
 	EvaluableNodeReference new_assoc(evaluableNodeManager->AllocNode(en, EvaluableNodeManager::ENMM_REMOVE_ALL), true);
@@ -160,7 +160,7 @@ EvaluableNodeReference Interpreter::InterpretNode_ENT_CONTAINED_ENTITIES_and_COM
 	}
 
 	//perform query
-	auto result = EntityQueryCaches::GetEntitiesMatchingQuery(source_entity, conditionsBuffer, evaluableNodeManager, return_query_value);
+	auto result = EntityQueryCaches::GetEntitiesMatchingQuery(source_entity, conditionsBuffer, evaluableNodeManager, return_query_value, query_params);
 
 	//free query_params after the query just in case query_params is the only place that a given string id exists,
 	//so the value isn't swapped out
@@ -168,6 +168,66 @@ EvaluableNodeReference Interpreter::InterpretNode_ENT_CONTAINED_ENTITIES_and_COM
 	return result;
 }
 
+EvaluableNodeReference Interpreter::InterpretNode_ENT_CACHE_CONTAINED_ENTITY_LABELS(EvaluableNode *en, bool immediate_result)
+{
+	auto &ocn = en->GetOrderedChildNodes();
+
+	if(ocn.size() < 1)
+		return EvaluableNodeReference::Null();
+
+	//not allowed if don't have a Entity to work within
+	if(curEntity == nullptr)
+		return EvaluableNodeReference::Null();
+
+	EvaluableNodeReference entity_id_path = EvaluableNodeReference::Null();
+	EvaluableNodeReference label_names = EvaluableNodeReference::Null();
+	if(ocn.size() == 1)
+	{
+		label_names = InterpretNodeForImmediateUse(ocn[0]);
+	}
+	else
+	{
+		entity_id_path = InterpretNodeForImmediateUse(ocn[0]);
+		auto node_stack = CreateInterpreterNodeStackStateSaver(entity_id_path);
+		label_names = InterpretNodeForImmediateUse(ocn[1]);
+	}
+
+	//only labels that already exist as strings can be on any contained entity
+	std::vector<StringInternPool::StringID> label_sids;
+	if(label_names != nullptr)
+	{
+		if(label_names->IsOrderedArray())
+		{
+			for(auto &label_node : label_names->GetOrderedChildNodesReference())
+			{
+				StringInternPool::StringID label_sid = EvaluableNode::ToStringIDIfExists(label_node);
+				if(label_sid != StringInternPool::NOT_A_STRING_ID)
+					label_sids.push_back(label_sid);
+			}
+		}
+		else
+		{
+			StringInternPool::StringID label_sid = EvaluableNode::ToStringIDIfExists(label_names);
+			if(label_sid != StringInternPool::NOT_A_STRING_ID)
+				label_sids.push_back(label_sid);
+		}
+	}
+
+	EntityReadReference source_entity = TraverseToExistingEntityReferenceViaEvaluableNodeIDPath<EntityReadReference>(curEntity, entity_id_path);
+	evaluableNodeManager->FreeNodeTreeIfPossible(entity_id_path);
+	if(source_entity == nullptr)
+	{
+		evaluableNodeManager->FreeNodeTreeIfPossible(label_names);
+		return EvaluableNodeReference::Null();
+	}
+
+	bool cached = EntityQueryCaches::CacheContainedEntityLabels(source_entity, label_sids);
+
+	//free label_names after caching in case it holds the only reference to a label's string id
+	evaluableNodeManager->FreeNodeTreeIfPossible(label_names);
+	return AllocReturn(cached, immediate_result);
+}
+
 EvaluableNodeReference Interpreter::InterpretNode_ENT_QUERY_and_COMPUTE_opcodes(EvaluableNode *en, bool immediate_result)
 {
 	//use stack to lock it in place, but copy it back to temporary before returning
@@ -646,3 +706,195 @@ EvaluableNodeReference Interpreter::InterpretNode_ENT_CALL_CONTAINER(EvaluableNo
 
 	return copied_result;
 }
+
+EvaluableNodeReference Interpreter::InterpretNode_ENT_CALL_ON_CONTAINED_ENTITIES(EvaluableNode *en, bool immediate_result)
+{
+	auto &ocn = en->GetOrderedChildNodes();
+
+	//not allowed if don't have a Entity to call within
+	if(curEntity == nullptr)
+		return EvaluableNodeReference::Null();
+
+	//get the ids of the entities to call, or null for all contained entities
+	EvaluableNodeReference entity_ids = EvaluableNodeReference::Null();
+	if(ocn.size() > 0)
+		entity_ids = InterpretNodeForImmediateUse(ocn[0]);
+
+	auto node_stack = CreateInterpreterNodeStackStateSaver(entity_ids);
+
+	StringRef entity_label_sid;
+	if(ocn.size() > 1)
+		entity_label_sid.SetIDWithReferenceHandoff(InterpretNodeIntoStringIDValueWithReference(ocn[1]));
+
+	PerformanceConstraints perf_constraints;
+	PerformanceConstraints *perf_constraints_ptr = nullptr;
+	if(PopulatePerformanceConstraintsFromParams(ocn, 3, perf_constraints, true))
+		perf_constraints_ptr = &perf_constraints;
+
+	//attempt to get arguments
+	EvaluableNodeReference args = EvaluableNodeReference::Null();
+	if(ocn.size() > 2)
+		args = InterpretNodeForImmediateUse(ocn[2]);
+
+	node_stack.PushEvaluableNode(args);
+
+	std::vector<Entity *> called_entities;
+#ifdef MULTITHREAD_SUPPORT
+	Concurrency::ReadLock enm_lock;
+#endif
+
+	{
+		//lock the container so none of the entities can be removed while locking their memory
+		EntityReadReference container(curEntity);
+		if(EvaluableNode::IsNull(entity_ids))
+		{
+			called_entities = container->GetContainedEntities();
+		}
+		else
+		{
+			for(auto &id_node : entity_ids->GetOrderedChildNodes())
+			{
+				Entity *called_entity = container->GetContainedEntity(EvaluableNode::ToStringIDIfExists(id_node));
+				if(called_entity != nullptr)
+					called_entities.push_back(called_entity);
+			}
+		}
+
+	#ifdef MULTITHREAD_SUPPORT
+		//lock memory before allocating call stacks, then can release the container lock
+		enm_lock = Concurrency::ReadLock(container->evaluableNodeManager.memoryModificationMutex);
+	#endif
+	}
+
+	//copy the arguments to each called entity; the arguments are only read, so they are copied from the same tree
+	std::vector<EvaluableNode *> call_stacks;
+	call_stacks.reserve(called_entities.size());
+	for(Entity *called_entity : called_entities)
+	{
+		EvaluableNodeReference called_entity_args = called_entity->evaluableNodeManager.DeepAllocCopy(args);
+		call_stacks.push_back(ConvertArgsToCallStack(called_entity_args, called_entity->evaluableNodeManager));
+	}
+
+	node_stack.PopEvaluableNode();
+	evaluableNodeManager->FreeNodeTreeIfPossible(args);
+
+	//the constraints are shared by all of the calls, so constrain from this entity, which contains all of the called entities
+	PopulatePerformanceCounters(perf_constraints_ptr, curEntity);
+
+	std::vector<EvaluableNodeReference> results(called_entities.size());
+#ifdef MULTITHREAD_SUPPORT
+	auto call_entity = [this, &entity_label_sid, &called_entities, &call_stacks, perf_constraints_ptr, &results]
+		(size_t index, Concurrency::ReadLock *call_enm_lock)
+#else
+	auto call_entity = [this, &entity_label_sid, &called_entities, &call_stacks, perf_constraints_ptr, &results]
+		(size_t index)
+#endif
+	{
+		results[index] = called_entities[index]->Execute(entity_label_sid,
+			call_stacks[index], false, this, writeListeners, printListener, perf_constraints_ptr
+		#ifdef MULTITHREAD_SUPPORT
+			, call_enm_lock
+		#endif
+			);
+	};
+
+#ifdef MULTITHREAD_SUPPORT
+	//this interpreter is no longer executing
+	memoryModificationLock.unlock();
+
+	bool executed_concurrently = false;
+	if(en->GetConcurrency() && called_entities.size() > 1)
+	{
+		auto enqueue_task_lock = Concurrency::threadPool.BeginEnqueueBatchTask();
+		if(enqueue_task_lock.AreThreadsAvailable())
+		{
+			//the memory lock can't be held while waiting on the tasks or garbage collection could not proceed,
+			// so keep the call stacks referenced until each task has obtained its own lock
+			for(size_t i = 0; i < called_entities.size(); i++)
+				called_entities[i]->evaluableNodeManager.KeepNodeReferences(call_stacks[i]);
+			enm_lock.unlock();
+
+			ThreadPool::CountableTaskSet task_set(called_entities.size());
+			for(size_t i = 0; i < called_entities.size(); i++)
+			{
+				Concurrency::threadPool.BatchEnqueueTask(
+					[&call_entity, &called_entities, &call_stacks, &results, i, &task_set]
+					{
+						auto &called_enm = called_entities[i]->evaluableNodeManager;
+						Concurrency::ReadLock task_enm_lock(called_enm.memoryModificationMutex);
+						call_entity(i, &task_enm_lock);
+
+						//keep the result until it has been copied back
+						called_enm.KeepNodeReferences(results[i].GetReference());
+						called_enm.FreeNodeReferences(call_stacks[i]);
+						task_set.MarkTaskCompleted();
+					}
+				);
+			}
+
+			enqueue_task_lock.Unlock();
+
+			Concurrency::threadPool.ChangeCurrentThreadStateFromActiveToWaiting();
+			task_set.WaitForTasks();
+			Concurrency::threadPool.ChangeCurrentThreadStateFromWaitingToActive();
+
+			executed_concurrently = true;
+		}
+	}
+
+	if(!executed_concurrently)
+	{
+		//each call may release the memory lock while collecting garbage,
+		// so keep the call stacks not yet used and the results not yet copied back referenced
+		for(size_t i = 0; i < called_entities.size(); i++)
+			called_entities[i]->evaluableNodeManager.KeepNodeReferences(call_stacks[i]);
+
+		for(size_t i = 0; i < called_entities.size(); i++)
+		{
+			call_entity(i, &enm_lock);
+
+			auto &called_enm = called_entities[i]->evaluableNodeManager;
+			called_enm.KeepNodeReferences(results[i].GetReference());
+			called_enm.FreeNodeReferences(call_stacks[i]);
+		}
+	}
+#else
+	for(size_t i = 0; i < called_entities.size(); i++)
+		call_entity(i);
+#endif
+
+	if(performanceConstraints != nullptr)
+		performanceConstraints->AccruePerformanceCounters(perf_constraints_ptr);
+
+#ifdef MULTITHREAD_SUPPORT
+	//this interpreter is executing again
+	memoryModificationLock.lock();
+	if(enm_lock.owns_lock())
+		enm_lock.unlock();
+#endif
+
+	//copy each result into an assoc keyed by the id of the entity called
+	EvaluableNodeReference results_assoc(evaluableNodeManager->AllocNode(ENT_ASSOC), true);
+	results_assoc->ReserveMappedChildNodes(called_entities.size());
+	for(size_t i = 0; i < called_entities.size(); i++)
+	{
+		Entity *called_entity = called_entities[i];
+		EvaluableNodeReference result = results[i];
+
+		//call opcodes should consume the outer return opcode if there is one
+		if(result.IsNonNullNodeReference() && result->GetType() == ENT_RETURN)
+			result = RemoveTopConcludeOrReturnNode(result, &called_entity->evaluableNodeManager);
+
+	#ifdef MULTITHREAD_SUPPORT
+		called_entity->evaluableNodeManager.FreeNodeReferences(results[i].GetReference());
+	#endif
+
+		EvaluableNodeReference copied_result = evaluableNodeManager->DeepAllocCopy(result);
+		called_entity->evaluableNodeManager.FreeNodeTreeIfPossible(result);
+
+		results_assoc->SetMappedChildNode(called_entity->GetIdStringId(), copied_result);
+		results_assoc.UpdatePropertiesBasedOnAttachedNode(copied_result);
+	}
+
+	return results_assoc;
+}
@@ -542,14 +542,38 @@ EvaluableNodeReference Interpreter::InterpretNode_ENT_DESTROY_ENTITIES(Evaluable
 	if(curEntity == nullptr)
 		return EvaluableNodeReference::Null();
 
+	auto &ocn = en->GetOrderedChildNodes();
+
+	//evaluate all of the ids first; if every id refers to an entity directly contained by curEntity,
+	// then they can be removed as one batch so the container's indices and query caches are only repaired once
+	EvaluableNodeReference id_nodes(evaluableNodeManager->AllocNode(ENT_LIST), true);
+	id_nodes->ReserveOrderedChildNodes(ocn.size());
+	auto node_stack = CreateInterpreterNodeStackStateSaver(id_nodes);
+
+	bool all_ids_directly_contained = (ocn.size() > 1);
+	for(auto &cn : ocn)
+	{
+		auto id_node = InterpretNodeForImmediateUse(cn);
+		if(EvaluableNode::IsNull(id_node) || id_node->GetType() == ENT_LIST)
+			all_ids_directly_contained = false;
+
+		id_nodes->AppendOrderedChildNode(id_node);
+		id_nodes.UpdatePropertiesBasedOnAttachedNode(id_node);
+	}
+
+	if(all_ids_directly_contained)
+	{
+		bool all_destroys_successful = DestroyContainedEntities(id_nodes);
+		evaluableNodeManager->FreeNodeTreeIfPossible(id_nodes);
+		return AllocReturn(all_destroys_successful, immediate_result);
+	}
+
 	bool all_destroys_successful = true;
-	for(auto &cn : en->GetOrderedChildNodes())
+	for(auto &id_node : id_nodes->GetOrderedChildNodesReference())
 	{
 		//get the id of the source entity
-		auto id_node = InterpretNodeForImmediateUse(cn);
 		auto [entity, entity_container]
 			= TraverseToEntityReferenceAndContainerViaEvaluableNodeIDPath<EntityWriteReference>(curEntity, id_node);
-		evaluableNodeManager->FreeNodeTreeIfPossible(id_node);
 
 		//need a valid entity that isn't itself or currently has execution
 		if(entity == nullptr || entity == curEntity || entity->IsEntityCurrentlyBeingExecuted())
@@ -583,9 +607,74 @@ EvaluableNodeReference Interpreter::InterpretNode_ENT_DESTROY_ENTITIES(Evaluable
 		delete entity;
 	}
 
+	evaluableNodeManager->FreeNodeTreeIfPossible(id_nodes);
 	return AllocReturn(all_destroys_successful, immediate_result);
 }
 
+bool Interpreter::DestroyContainedEntities(EvaluableNode *id_nodes)
+{
+	bool all_destroys_successful = true;
+
+	//lock the container before the entities, as traversal does
+	EntityWriteReference container(curEntity);
+
+	std::vector<EntityWriteReference> entities;
+	std::vector<StringInternPool::StringID> entity_ids;
+	FastHashSet<StringInternPool::StringID> entity_ids_found;
+	Entity::EntityReferenceBufferReference<EntityWriteReference> contained_entities;
+	for(auto &id_node : id_nodes->GetOrderedChildNodesReference())
+	{
+		StringInternPool::StringID id_sid = EvaluableNode::ToStringIDIfExists(id_node);
+		Entity *entity = curEntity->GetContainedEntity(id_sid);
+
+		//need a valid entity that currently does not have execution and isn't already being destroyed
+		if(entity == nullptr || !entity_ids_found.insert(entity->GetIdStringId()).second)
+		{
+			all_destroys_successful = false;
+			continue;
+		}
+
+		EntityWriteReference entity_reference(entity);
+		if(entity->IsEntityCurrentlyBeingExecuted())
+		{
+			all_destroys_successful = false;
+			continue;
+		}
+
+		//lock all entities contained within
+		if(entities.size() == 0)
+			contained_entities = entity->GetAllDeeplyContainedEntityReferencesGroupedByDepth<EntityWriteReference>();
+		else
+			entity->AppendAllDeeplyContainedEntityReferencesGroupedByDepth(contained_entities);
+
+		entity_ids.push_back(entity->GetIdStringId());
+		entities.emplace_back(std::move(entity_reference));
+	}
+
+	curEntity->RemoveContainedEntities(entity_ids, writeListeners);
+
+	contained_entities.Clear();
+	container = EntityWriteReference();
+
+	for(auto &entity_reference : entities)
+	{
+		Entity *entity = entity_reference;
+
+	#ifdef MULTITHREAD_SUPPORT
+		//free entity write lock before calling delete
+		entity_reference.lock.unlock();
+	#endif
+
+		//accumulate usage -- gain back freed resources
+		if(ConstrainedAllocatedNodes())
+			performanceConstraints->curNumAllocatedNodesAllocatedToEntities -= entity->GetDeepSizeInNodes();
+
+		delete entity;
+	}
+
+	return all_destroys_successful;
+}
+
 EvaluableNodeReference Interpreter::InterpretNode_ENT_LOAD(EvaluableNode *en, bool immediate_result)
 {
 	auto &ocn = en->GetOrderedChildNodes();
@@ -1044,6 +1044,7 @@ EvaluableNodeReference Interpreter::InterpretNode_ENT_GENERALIZED_DISTANCE(Evalu
 
 	dist_eval.highAccuracyDistances = true;
 	dist_eval.recomputeAccurateDistances = false;
+	dist_eval.rerankAccurateDistances = false;
 	dist_eval.InitializeParametersAndFeatureParams();
 	
 	double value = dist_eval.ComputeMinkowskiDistance(location, location_types, origin, origin_types, true);
@@ -7,6 +7,8 @@
 #include "StringManipulation.h"
 
 //system headers:
+#include <array>
+#include <cmath>
 #include <memory>
 #include <queue>
 #include <string>
@@ -300,6 +302,53 @@ public:
 	#endif
 	}
 
+	//returns the id of the string of value if value is a nonnegative integer below numCachedIntegerStrings,
+	// otherwise returns NOT_A_STRING_ID
+	//the string is created on first use and the cache holds a reference to it, so that numeric keys
+	// do not need to be formatted and looked up on every access
+	//does not create a new reference for the caller
+	inline StringID GetCachedIntegerStringID(double value)
+	{
+		//negative zero is formatted differently than zero
+		if(!(value >= 0.0 && value < numCachedIntegerStrings) || std::signbit(value))
+			return NOT_A_STRING_ID;
+
+		size_t index = static_cast<size_t>(value);
+		if(static_cast<double>(index) != value)
+			return NOT_A_STRING_ID;
+
+		StringID id = cachedIntegerStringIds[index];
+		if(id != NOT_A_STRING_ID)
+			return id;
+
+		id = CreateStringReference(StringManipulation::NumberToString(index));
+
+	#if defined(MULTITHREAD_SUPPORT) || defined(MULTITHREAD_INTERFACE)
+		//if another thread cached it first, use its reference
+		StringID expected = NOT_A_STRING_ID;
+		if(!cachedIntegerStringIds[index].compare_exchange_strong(expected, id))
+		{
+			DestroyStringReference(id);
+			id = expected;
+		}
+	#else
+		cachedIntegerStringIds[index] = id;
+	#endif
+
+		return id;
+	}
+
+	//releases the references held by the integer string cache
+	//not threadsafe with GetCachedIntegerStringID; intended for checking that no other strings remain in use
+	inline void ClearCachedIntegerStrings()
+	{
+		for(auto &id : cachedIntegerStringIds)
+		{
+			DestroyStringReference(id);
+			id = NOT_A_STRING_ID;
+		}
+	}
+
 	//destroys 2 StringReferences
 	inline void DestroyStringReferences(StringID sid_1, StringID sid_2)
 	{
@@ -388,6 +437,14 @@ protected:
 	//mapping from string to ID (index of idToRefCountAndString)
 	FastHashMap<std::string, std::unique_ptr<StringInternStringData>> stringToID;
 
+	//ids of the strings of the integers below numCachedIntegerStrings, or NOT_A_STRING_ID if not yet cached
+	static constexpr size_t numCachedIntegerStrings = 1 << 12;
+#if defined(MULTITHREAD_SUPPORT) || defined(MULTITHREAD_INTERFACE)
+	std::array<std::atomic<StringID>, numCachedIntegerStrings> cachedIntegerStringIds{};
+#else
+	std::array<StringID, numCachedIntegerStrings> cachedIntegerStringIds{};
+#endif
+
 public:
 	//indicates that it is not a string, like NaN or null
 	static constexpr StringID NOT_A_STRING_ID = nullptr;
@@ -6,9 +6,19 @@
 #include "Amalgam.h"
 
 //system headers:
+#include <cmath>
 #include <iostream>
 #include <string>
 
+//executes label on the entity with handle and returns the resulting json
+static std::string ExecuteEntityJsonString(char *handle, char *label, char *json)
+{
+	char *result = ExecuteEntityJsonPtr(handle, label, json);
+	std::string result_string(result);
+	DeleteString(result);
+	return result_string;
+}
+
 int main(int argc, char* argv[])
 {
 	// Print version:
@@ -24,7 +34,48 @@ int main(int argc, char* argv[])
 	{
 		char label[] = "test";
 		ExecuteEntity(handle, label);
+
+		// Execute with numeric arguments and results, where only numbers are returned as numbers:
+		char add_one_label[] = "add_one";
+		char x_name[] = "x";
+		char *arg_names[] = { x_name };
+		double arg_values[] = { 2.0 };
+		double number_result = ExecuteEntityNumber(handle, add_one_label, 1, arg_names, arg_values);
+
+		char numeric_string_label[] = "numeric_string";
+		double numeric_string_result = ExecuteEntityNumber(handle, numeric_string_label, 0, nullptr, nullptr);
+
+		char null_label[] = "null_result";
+		double null_result = ExecuteEntityNumber(handle, null_label, 0, nullptr, nullptr);
+
+		// Repeat a query with the query result cache enabled, then again after a contained entity is modified:
+		SetQueryResultCacheEnabled(true);
+		char nearest_label[] = "nearest_case";
+		char move_label[] = "move_case_0";
+		char null_json[] = "null";
+		std::string first_nearest = ExecuteEntityJsonString(handle, nearest_label, null_json);
+		std::string cached_nearest = ExecuteEntityJsonString(handle, nearest_label, null_json);
+		ExecuteEntity(handle, move_label);
+		std::string nearest_after_write = ExecuteEntityJsonString(handle, nearest_label, null_json);
+		SetQueryResultCacheEnabled(false);
+
 		DestroyEntity(handle);
+
+		if(number_result != 3.0 || !std::isnan(numeric_string_result) || !std::isnan(null_result))
+		{
+			std::cout << "FAIL: ExecuteEntityNumber returned " << number_result << ", "
+				<< numeric_string_result << ", " << null_result << std::endl;
+			return 1;
+		}
+
+		if(cached_nearest != first_nearest || first_nearest.find("case_0\"") != std::string::npos
+			|| nearest_after_write.find("case_0\"") == std::string::npos)
+		{
+			std::cout << "FAIL: query result cache returned " << first_nearest << ", "
+				<< cached_nearest << ", " << nearest_after_write << std::endl;
+			return 1;
+		}
+
 		return 0;
 	}
 